@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 #include <stdint.h>
 #include <string.h>
 #include <pthread.h>
@@ -12,6 +13,8 @@
 #include <infiniband/arch.h>
 #include <rdma/rdma_cma.h>
 
+#include "ec-crc.h"
+
 #define DATASIZE (1 << 30)
 // COLUMN and ROW decides the disperse config
 #define COLUMN 16 
@@ -22,11 +25,28 @@
 #define SENDSIZE (DATASIZE / SERVER)
 // bytes received from per server
 #define RECVSIZE (DATASIZE / SERVER / COLUMN * ROW)
+// fragment format expected from the servers (EC_METHOD_FORMAT, 1 is the
+// 512 byte chunk format)
+#define FORMAT 1
+// size of each fragment a server returns
+#define FRAGSIZE (SENDSIZE / COLUMN)
+// with -c, the server also returns one CRC32C per chunk of the fragments,
+// after them, in the order of the chunks
+#define CHUNKSIZE 512
+#define CRCSIZE (RECVSIZE / CHUNKSIZE * sizeof(uint32_t))
+
+// default pipeline window (-w): work requests in flight per connection.
+// the queues and the CQ are sized from it, within the device limits
+#define WINDOW 64
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
 
 enum {
 	RESOLVE_TIMEOUT_MS	= 5000,
 };
 
+static unsigned window = WINDOW;
+
 struct timeval time_start;
 
 void start_timer() {
@@ -45,8 +65,31 @@ void print_timer() {
 }
 
 struct pdata {
-	uint64_t	buf_va;
-	uint32_t	buf_rkey;
+	uint32_t	seg_size;	/* largest segment the server takes */
+	uint32_t	format;		/* fragment format of the server */
+};
+
+/* operation of a request, sent as immediate data of each segment. the
+   last segment is flagged with OP_LAST, and an encode flagged with OP_CRC
+   is answered with the checksums of the fragments */
+enum {
+	OP_ENCODE	= 0,
+	OP_REPAIR	= 1,
+};
+
+#define OP_LAST (1U << 31)
+#define OP_CRC	(1U << 30)
+
+/* repair request: the COLUMN surviving fragments of rows[] follow it at
+   REPAIR_HDRSIZE, and the server sends back the fragments of missing[]
+   (nothing if it rejects the request). Fields are in network order. */
+#define REPAIR_HDRSIZE 4096
+
+struct repair_req {
+	uint32_t	frag_size;
+	uint32_t	missing_count;
+	uint32_t	rows[COLUMN];
+	uint32_t	missing[ROW - COLUMN];
 };
 
 struct RdmaConn {
@@ -61,8 +104,30 @@ struct RdmaConn {
 	char				*recv_buf;
 	char 				*send_buf;	
 	struct pdata			server_pdata;		
+	unsigned			depth;	// send queue depth
 };
 
+int size_queues(struct ibv_context *verbs, struct ibv_qp_init_attr *qp_attr,
+		int *cqe)
+{
+	//size the queues of a connection for the pipeline window: window
+	//sends and window receives, with a CQ entry for each of them. the
+	//buffers are contiguous, one scatter/gather entry is enough
+	struct ibv_device_attr dev;
+
+	if (ibv_query_device(verbs, &dev))
+		return 1;
+
+	qp_attr->cap.max_send_wr  = MIN(window, (unsigned)dev.max_qp_wr);
+	qp_attr->cap.max_send_sge = 1;
+	qp_attr->cap.max_recv_wr  = MIN(window, (unsigned)dev.max_qp_wr);
+	qp_attr->cap.max_recv_sge = 1;
+	*cqe = MIN(qp_attr->cap.max_send_wr + qp_attr->cap.max_recv_wr,
+		   (unsigned)dev.max_cqe);
+
+	return 0;
+}
+
 struct RdmaConn* my_connect(const char* server)
 {
 	//connect to a particular server
@@ -81,6 +146,7 @@ struct RdmaConn* my_connect(const char* server)
 	struct ibv_mr		       *recv_mr;
 	struct ibv_mr		       *send_mr;
 	struct ibv_qp_init_attr		qp_attr = { };
+	int				cqe;
 
 	struct addrinfo		       *res, *t;
 	struct addrinfo			hints = {
@@ -148,11 +214,14 @@ struct RdmaConn* my_connect(const char* server)
 	if (!pd)
 		return NULL;
 
+	if (size_queues(cm_id->verbs, &qp_attr, &cqe))
+		return NULL;
+
 	comp_chan = ibv_create_comp_channel(cm_id->verbs);
 	if (!comp_chan)
 		return NULL;
 
-	cq = ibv_create_cq(cm_id->verbs, 10, NULL, comp_chan, 0);
+	cq = ibv_create_cq(cm_id->verbs, cqe, NULL, comp_chan, 0);
 	if (!cq)
 		return NULL;
 
@@ -161,16 +230,16 @@ struct RdmaConn* my_connect(const char* server)
 
 	/* register memory */
 
-	send_buf = (char*) malloc(SENDSIZE);
-	recv_buf = (char*) malloc(RECVSIZE);
+	send_buf = (char*) malloc(SENDSIZE + REPAIR_HDRSIZE);
+	recv_buf = (char*) malloc(RECVSIZE + CRCSIZE);
 
-	recv_mr = ibv_reg_mr(pd, recv_buf, RECVSIZE ,
+	recv_mr = ibv_reg_mr(pd, recv_buf, RECVSIZE + CRCSIZE,
 			IBV_ACCESS_LOCAL_WRITE |
 			IBV_ACCESS_REMOTE_READ |
 			IBV_ACCESS_REMOTE_WRITE);
 	if (!recv_mr)
 		return NULL;
-	send_mr = ibv_reg_mr(pd, send_buf, SENDSIZE,
+	send_mr = ibv_reg_mr(pd, send_buf, SENDSIZE + REPAIR_HDRSIZE,
 			IBV_ACCESS_LOCAL_WRITE |
 			IBV_ACCESS_REMOTE_READ |
 			IBV_ACCESS_REMOTE_WRITE);
@@ -179,11 +248,6 @@ struct RdmaConn* my_connect(const char* server)
 
 	/* create queue pair */
 
-	qp_attr.cap.max_send_wr	 = 10;
-	qp_attr.cap.max_send_sge = 1;
-	qp_attr.cap.max_recv_wr	 = 10;
-	qp_attr.cap.max_recv_sge = 1;
-
 	qp_attr.send_cq		 = cq;
 	qp_attr.recv_cq		 = cq;
 
@@ -195,6 +259,8 @@ struct RdmaConn* my_connect(const char* server)
 
 	conn_param.initiator_depth = 1;
 	conn_param.retry_count	   = 7;
+	// the server's receive ring may be empty for a while: wait for it
+	conn_param.rnr_retry_count = 7;
 
 	/* Connect to server */
 
@@ -214,6 +280,12 @@ struct RdmaConn* my_connect(const char* server)
 
 	rdma_ack_cm_event(event);
 
+	if (ntohl(server_pdata.format) != FORMAT) {
+		fprintf(stderr, "%s: fragment format %u, expected %u\n", server,
+			ntohl(server_pdata.format), FORMAT);
+		return NULL;
+	}
+
 	rdma_conn = (struct RdmaConn*) malloc(sizeof(struct RdmaConn));
 	rdma_conn->cm_channel = cm_channel;
 	rdma_conn->cm_id = cm_id;
@@ -225,12 +297,45 @@ struct RdmaConn* my_connect(const char* server)
 	rdma_conn->recv_buf = recv_buf;
 	rdma_conn->send_buf = send_buf;
 	memcpy(&rdma_conn->server_pdata, &server_pdata, sizeof server_pdata);
+	rdma_conn->depth = qp_attr.cap.max_send_wr;
 	return rdma_conn;
 }
 
-int my_send(struct RdmaConn *conn)
+int wait_sends(struct RdmaConn *conn, unsigned count)
 {
-	//send data to server
+	//wait for count send completions
+	//if succeed return 0
+	//otherwise return 1
+	struct ibv_wc			wc;
+	void			       *cq_context;
+	struct ibv_cq			*evt_cq;
+	int				n;
+
+	while (count > 0) {
+		n = ibv_poll_cq(conn->cq, 1, &wc);
+		if (n < 0)
+			return 1;
+		if (n == 0) {
+			if (ibv_get_cq_event(conn->comp_chan, &evt_cq,
+					     &cq_context))
+				return 1;
+			ibv_ack_cq_events(conn->cq, 1);
+			if (ibv_req_notify_cq(conn->cq, 0))
+				return 1;
+			continue;
+		}
+		if (wc.status != IBV_WC_SUCCESS)
+			return 1;
+		count--;
+	}
+
+	return 0;
+}
+
+int my_send(struct RdmaConn *conn, uint32_t len, uint32_t op)
+{
+	//send len bytes of send_buf to server, as a request of operation op,
+	//in segments of at most seg_size bytes with up to depth in flight
 	//if succeed return 0
 	//otherwise return 1
 	struct ibv_sge			sge;
@@ -238,29 +343,24 @@ int my_send(struct RdmaConn *conn)
 	struct ibv_send_wr	       *bad_send_wr;
 	struct ibv_recv_wr		recv_wr = { };
 	struct ibv_recv_wr	       *bad_recv_wr;
-	struct ibv_wc			wc;
-	void			       *cq_context;
-	struct ibv_cq			*evt_cq;
-
-	int				err;
-	int 				n;
+	uint32_t			seg_size;
+	uint32_t			off, seg;
+	unsigned			inflight = 0;
 
-	struct rdma_event_channel      *cm_channel = conn->cm_channel;
 	struct rdma_cm_id	       *cm_id = conn->cm_id;
-	struct ibv_pd		       *pd = conn->pd;
-	struct ibv_comp_channel	       *comp_chan = conn->comp_chan;
-	struct ibv_cq		       *cq = conn->cq;
 	struct ibv_mr		       *recv_mr = conn->recv_mr;
 	struct ibv_mr		       *send_mr = conn->send_mr;
 	char				*recv_buf = conn->recv_buf;
 	char 				*send_buf = conn->send_buf;	
-	struct pdata			server_pdata;
-	memcpy(&server_pdata, &conn->server_pdata, sizeof(struct pdata));
+
+	seg_size = ntohl(conn->server_pdata.seg_size);
+	if (seg_size == 0)
+		return 1;
 
 	/* Prepost receive */
 
 	sge.addr   = recv_buf;
-	sge.length = RECVSIZE;
+	sge.length = RECVSIZE + CRCSIZE;
 	sge.lkey   = recv_mr->lkey;
 
 	recv_wr.wr_id   = 0;
@@ -272,39 +372,35 @@ int my_send(struct RdmaConn *conn)
 
 	/* send data to the server */
 
-	sge.addr   = send_buf;
-	sge.length = SENDSIZE;
-	sge.lkey   = send_mr->lkey;
+	for (off = 0; off < len; off += seg) {
+		seg = len - off < seg_size ? len - off : seg_size;
 
-	send_wr.wr_id		    = 1;
-	send_wr.opcode		    = IBV_WR_SEND;
-	send_wr.send_flags	    = IBV_SEND_SIGNALED;
-	send_wr.sg_list		    = &sge;
-	send_wr.num_sge		    = 1;
-	send_wr.wr.rdma.rkey	    = ntohl(server_pdata.buf_rkey);
-	send_wr.wr.rdma.remote_addr = ntohll(server_pdata.buf_va);
-
-	if (ibv_post_send(cm_id->qp, &send_wr, &bad_send_wr))
-		return 1;
-
-	/* Wait for send completion */
-
-	if (ibv_get_cq_event(comp_chan, &evt_cq, &cq_context))
-		return 1;
-
-	if (ibv_poll_cq(cq, 1, &wc) < 1)
-		return 1;
+		if (inflight == conn->depth) {
+			if (wait_sends(conn, 1))
+				return 1;
+			inflight--;
+		}
 
-	if (wc.status != IBV_WC_SUCCESS)
-		return 1;
+		sge.addr   = (uintptr_t)(send_buf + off);
+		sge.length = seg;
+		sge.lkey   = send_mr->lkey;
 
-	ibv_ack_cq_events(cq, 1);
+		send_wr.wr_id		    = 1;
+		send_wr.opcode		    = IBV_WR_SEND_WITH_IMM;
+		send_wr.imm_data	    = htonl(off + seg == len ?
+						    op | OP_LAST : op);
+		send_wr.send_flags	    = IBV_SEND_SIGNALED;
+		send_wr.sg_list		    = &sge;
+		send_wr.num_sge		    = 1;
 
-	if (ibv_req_notify_cq(cq, 0)) 
-		return 1;
+		if (ibv_post_send(cm_id->qp, &send_wr, &bad_send_wr))
+			return 1;
+		inflight++;
+	}
 
-	return 0;
+	/* Wait for send completions */
 
+	return wait_sends(conn, inflight);
 }
 
 int my_recv(struct RdmaConn *conn)
@@ -349,8 +445,6 @@ int my_recv(struct RdmaConn *conn)
 	send_wr.send_flags	    = IBV_SEND_SIGNALED;
 	send_wr.sg_list		    = &sge;
 	send_wr.num_sge		    = 1;
-	send_wr.wr.rdma.rkey	    = ntohl(server_pdata.buf_rkey);
-	send_wr.wr.rdma.remote_addr = ntohll(server_pdata.buf_va);
 
 	if (ibv_post_send(cm_id->qp, &send_wr, &bad_send_wr))
 		return 1;
@@ -380,6 +474,56 @@ int my_recv(struct RdmaConn *conn)
 	}
 }
 
+int my_repair(struct RdmaConn *conn)
+{
+	//rebuild the first ROW - COLUMN fragments returned by the last
+	//encode from the other ones and check them against the originals
+	//if succeed return 0
+	//otherwise return 1
+	struct repair_req *req = (struct repair_req *)conn->send_buf;
+	char *lost;
+	int i, err;
+
+	lost = malloc((ROW - COLUMN) * FRAGSIZE);
+	if (!lost)
+		return 1;
+	memcpy(lost, conn->recv_buf, (ROW - COLUMN) * FRAGSIZE);
+
+	memset(req, 0, REPAIR_HDRSIZE);
+	req->frag_size = htonl(FRAGSIZE);
+	req->missing_count = htonl(ROW - COLUMN);
+	for (i = 0; i < COLUMN; i++)
+		req->rows[i] = htonl(ROW - COLUMN + i);
+	for (i = 0; i < ROW - COLUMN; i++)
+		req->missing[i] = htonl(i);
+	memcpy(conn->send_buf + REPAIR_HDRSIZE,
+	       conn->recv_buf + (ROW - COLUMN) * FRAGSIZE, COLUMN * FRAGSIZE);
+
+	err = my_send(conn, REPAIR_HDRSIZE + COLUMN * FRAGSIZE, OP_REPAIR) ||
+	      my_recv(conn) ||
+	      memcmp(lost, conn->recv_buf, (ROW - COLUMN) * FRAGSIZE) != 0;
+	free(lost);
+
+	return err;
+}
+
+int check_crc(struct RdmaConn *conn)
+{
+	//check the fragments of the last encode against the checksums the
+	//server sent after them
+	//return the number of chunks that do not match
+	uint32_t *crc = (uint32_t *)(conn->recv_buf + RECVSIZE);
+	size_t i;
+	int bad = 0;
+
+	for (i = 0; i < RECVSIZE / CHUNKSIZE; i++)
+		if (ec_crc32c(0, (uint8_t *)conn->recv_buf + i * CHUNKSIZE,
+			      CHUNKSIZE) != ntohl(crc[i]))
+			bad++;
+
+	return bad;
+}
+
 void* pwork(void *param)
 {
         my_recv((struct RdmaConn*) param);
@@ -389,8 +533,25 @@ int main(int argc, char *argv[])
 {
 	char servers[4][20];
 	struct RdmaConn** conns = malloc(SERVER * sizeof(struct RdmaConn*));
-	int i;
+	int i, opt, crc = 0;
 	pthread_t *threads;
+
+	while ((opt = getopt(argc, argv, "w:c")) != -1) {
+		switch (opt) {
+		case 'w':
+			window = atoi(optarg);
+			break;
+		case 'c':
+			crc = 1;
+			break;
+		default:
+			goto usage;
+		}
+	}
+	if (window == 0)
+		goto usage;
+	ec_crc32c_initialize();
+
 	strcpy(servers[0], "10.0.0.6");
 	strcpy(servers[1], "10.0.0.7");
 	strcpy(servers[2], "10.0.0.8");
@@ -405,7 +566,9 @@ int main(int argc, char *argv[])
 
 	// send data one by one
 	for (i = 0; i < SERVER; i++) {
-		printf("%d send : %d\n", i, my_send(conns[i]));
+		printf("%d send : %d\n", i, my_send(conns[i], SENDSIZE,
+						     crc ? OP_ENCODE | OP_CRC :
+							   OP_ENCODE));
 	}
 
 	// concurrently gather data from servers
@@ -418,5 +581,20 @@ int main(int argc, char *argv[])
 	free(threads);
 
 	print_timer();
+
+	// with -c, check what was received
+	for (i = 0; crc && i < SERVER; i++)
+		printf("%d crc : %d bad chunks\n", i, check_crc(conns[i]));
+
+	// with "repair", rebuild lost fragments from the first server's
+	if (optind < argc && strcmp(argv[optind], "repair") == 0) {
+		start_timer();
+		printf("repair : %d\n", my_repair(conns[0]));
+		print_timer();
+	}
 	return 0;
+
+usage:
+	fprintf(stderr, "usage: %s [-w window] [-c] [repair]\n", argv[0]);
+	return 1;
 }
@@ -0,0 +1,441 @@
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <arpa/inet.h>
+
+#include <infiniband/arch.h>
+#include <rdma/rdma_cma.h>
+
+#include "ec-method.h"
+
+/* Pipelined repair of one fragment along a chain of servers. Each hop
+   receives the partial sum of the hops before it, adds its own surviving
+   fragment times its repair coefficient (see
+   ec_method_repair_coefficients) and forwards the result, so every link
+   carries one fragment's worth of data and the last hop, the one that
+   rebuilds the fragment, receives no more than that. The fragment flows
+   in SLICE byte slices, so all the hops work at the same time.
+
+   The chain is built from its end: the rebuilding hop is started first,
+   then each hop connects to the next one (-n) before accepting the
+   previous one (-l). */
+
+#define ROW 24
+#define COLUMN 16
+
+#define CHAIN_PORT "20080"
+/* Slices in flight on each link: the receive ring of a hop has SLOTS
+   buffers of SLICE bytes, reused once a slice has been forwarded. */
+#define SLICE (1 << 20)
+#define SLOTS 8
+
+enum {
+	RESOLVE_TIMEOUT_MS	= 5000,
+};
+
+struct pdata {
+	uint32_t	format;		/* EC_METHOD_FORMAT of the fragments */
+};
+
+struct link {
+	struct rdma_cm_id	*cm_id;
+	struct ibv_pd		*pd;
+	struct ibv_cq		*cq;
+	struct ibv_mr		*mr;
+};
+
+static struct rdma_event_channel *cm_channel;
+static char *ring;
+
+struct timeval time_start;
+
+void start_timer() {
+	gettimeofday(&time_start, NULL);
+}
+
+void print_timer() {
+	struct timeval time_end, res;
+
+	gettimeofday(&time_end, NULL);
+	timersub(&time_end, &time_start, &res);
+	printf("%.3lf s \n", res.tv_sec + res.tv_usec / 1000000.0);
+}
+
+static int get_event(enum rdma_cm_event_type type, struct rdma_cm_event *copy)
+{
+	struct rdma_cm_event *event;
+
+	if (rdma_get_cm_event(cm_channel, &event))
+		return -1;
+	if (event->event != type) {
+		rdma_ack_cm_event(event);
+		return -1;
+	}
+	if (copy)
+		*copy = *event;
+	rdma_ack_cm_event(event);
+
+	return 0;
+}
+
+/* Verbs objects of a link. Completions are busy polled: a hop does
+   nothing but wait for the next slice. */
+static int setup_link(struct link *l)
+{
+	struct ibv_qp_init_attr qp_attr = { };
+
+	l->pd = ibv_alloc_pd(l->cm_id->verbs);
+	if (!l->pd)
+		return -1;
+
+	l->cq = ibv_create_cq(l->cm_id->verbs, 2 * SLOTS, NULL, NULL, 0);
+	if (!l->cq)
+		return -1;
+
+	l->mr = ibv_reg_mr(l->pd, ring, (size_t)SLOTS * SLICE,
+			   IBV_ACCESS_LOCAL_WRITE);
+	if (!l->mr)
+		return -1;
+
+	qp_attr.cap.max_send_wr	 = SLOTS;
+	qp_attr.cap.max_send_sge = 1;
+	qp_attr.cap.max_recv_wr	 = SLOTS;
+	qp_attr.cap.max_recv_sge = 1;
+
+	qp_attr.send_cq		 = l->cq;
+	qp_attr.recv_cq		 = l->cq;
+
+	qp_attr.qp_type		 = IBV_QPT_RC;
+
+	return rdma_create_qp(l->cm_id, l->pd, &qp_attr);
+}
+
+static int post_slot(struct link *l, int slot)
+{
+	struct ibv_sge sge;
+	struct ibv_recv_wr recv_wr = { }, *bad_recv_wr;
+
+	sge.addr   = (uintptr_t)(ring + (size_t)slot * SLICE);
+	sge.length = SLICE;
+	sge.lkey   = l->mr->lkey;
+
+	recv_wr.wr_id	= slot;
+	recv_wr.sg_list = &sge;
+	recv_wr.num_sge = 1;
+
+	return ibv_post_recv(l->cm_id->qp, &recv_wr, &bad_recv_wr);
+}
+
+static int send_slot(struct link *l, int slot, size_t len)
+{
+	struct ibv_sge sge;
+	struct ibv_send_wr send_wr = { }, *bad_send_wr;
+
+	sge.addr   = (uintptr_t)(ring + (size_t)slot * SLICE);
+	sge.length = len;
+	sge.lkey   = l->mr->lkey;
+
+	send_wr.wr_id	   = slot;
+	send_wr.opcode	   = IBV_WR_SEND;
+	send_wr.send_flags = IBV_SEND_SIGNALED;
+	send_wr.sg_list	   = &sge;
+	send_wr.num_sge	   = 1;
+
+	return ibv_post_send(l->cm_id->qp, &send_wr, &bad_send_wr);
+}
+
+/* Each link only carries sends one way and receives the other way, so
+   the next completion, returned in wc, is always the one expected. */
+static int wait_slot(struct link *l, struct ibv_wc *wc)
+{
+	int n;
+
+	do {
+		n = ibv_poll_cq(l->cq, 1, wc);
+	} while (n == 0);
+
+	if (n < 0 || wc->status != IBV_WC_SUCCESS)
+		return -1;
+
+	return 0;
+}
+
+/* Connects to the next hop, whose receives are already posted. */
+static int connect_next(struct link *l, const char *host)
+{
+	struct rdma_conn_param conn_param = { };
+	struct rdma_cm_event event;
+	struct pdata pdata;
+	struct addrinfo *res, *t;
+	struct addrinfo hints = {
+		.ai_family   = AF_INET,
+		.ai_socktype = SOCK_STREAM
+	};
+	int err = -1;
+
+	if (rdma_create_id(cm_channel, &l->cm_id, NULL, RDMA_PS_TCP))
+		return -1;
+
+	if (getaddrinfo(host, CHAIN_PORT, &hints, &res))
+		return -1;
+	for (t = res; t; t = t->ai_next) {
+		err = rdma_resolve_addr(l->cm_id, NULL, t->ai_addr,
+					RESOLVE_TIMEOUT_MS);
+		if (!err)
+			break;
+	}
+	freeaddrinfo(res);
+	if (err)
+		return -1;
+
+	if (get_event(RDMA_CM_EVENT_ADDR_RESOLVED, NULL))
+		return -1;
+	if (rdma_resolve_route(l->cm_id, RESOLVE_TIMEOUT_MS))
+		return -1;
+	if (get_event(RDMA_CM_EVENT_ROUTE_RESOLVED, NULL))
+		return -1;
+
+	if (setup_link(l))
+		return -1;
+
+	conn_param.retry_count	   = 7;
+	/* The next hop reposts a slot once it has forwarded its slice: wait
+	   for it instead of failing the send. */
+	conn_param.rnr_retry_count = 7;
+
+	if (rdma_connect(l->cm_id, &conn_param))
+		return -1;
+	if (get_event(RDMA_CM_EVENT_ESTABLISHED, &event))
+		return -1;
+
+	memcpy(&pdata, event.param.conn.private_data, sizeof pdata);
+	if (ntohl(pdata.format) != EC_METHOD_FORMAT) {
+		fprintf(stderr, "%s: fragment format %u, expected %u\n", host,
+			ntohl(pdata.format), EC_METHOD_FORMAT);
+		return -1;
+	}
+
+	return 0;
+}
+
+/* Accepts the previous hop, after posting the receives of the first
+   slices. */
+static int accept_prev(struct link *l, int slices)
+{
+	struct rdma_conn_param conn_param = { };
+	struct rdma_cm_id *listen_id;
+	struct rdma_cm_event event;
+	struct sockaddr_in sin;
+	struct pdata pdata;
+	int i;
+
+	if (rdma_create_id(cm_channel, &listen_id, NULL, RDMA_PS_TCP))
+		return -1;
+
+	sin.sin_family	    = AF_INET;
+	sin.sin_port	    = htons(atoi(CHAIN_PORT));
+	sin.sin_addr.s_addr = INADDR_ANY;
+
+	if (rdma_bind_addr(listen_id, (struct sockaddr *)&sin))
+		return -1;
+	if (rdma_listen(listen_id, 1))
+		return -1;
+	if (get_event(RDMA_CM_EVENT_CONNECT_REQUEST, &event))
+		return -1;
+	l->cm_id = event.id;
+
+	if (setup_link(l))
+		return -1;
+
+	for (i = 0; i < slices && i < SLOTS; i++)
+		if (post_slot(l, i))
+			return -1;
+
+	pdata.format = htonl(EC_METHOD_FORMAT);
+
+	conn_param.rnr_retry_count  = 7;
+	conn_param.private_data	    = &pdata;
+	conn_param.private_data_len = sizeof pdata;
+
+	if (rdma_accept(l->cm_id, &conn_param))
+		return -1;
+
+	return get_event(RDMA_CM_EVENT_ESTABLISHED, NULL);
+}
+
+/* Prints the coefficient of each survivor of rows[] in the fragment of
+   row missing, in the order of rows[]. The survivors must be distinct
+   rows other than missing. */
+static int print_coefficients(uint32_t missing, char **argv)
+{
+	uint32_t rows[COLUMN];
+	uint8_t coef[COLUMN], seen[ROW] = { };
+	int i;
+
+	if (missing >= ROW)
+		return 1;
+	seen[missing] = 1;
+	for (i = 0; i < COLUMN; i++) {
+		rows[i] = atoi(argv[i]);
+		if (rows[i] >= ROW || seen[rows[i]])
+			return 1;
+		seen[rows[i]] = 1;
+	}
+	ec_method_repair_coefficients(COLUMN, rows, 1, &missing, coef);
+	for (i = 0; i < COLUMN; i++)
+		printf("%u:%u\n", rows[i], coef[i]);
+
+	return 0;
+}
+
+static void usage(const char *name)
+{
+	fprintf(stderr,
+		"usage: %s -s size [-l] [-n next] [-f fragment -c coef] "
+		"[-o output]\n"
+		"       %s -C missing row...\n", name, name);
+}
+
+int main(int argc, char *argv[])
+{
+	struct link	prev = { }, next = { };
+	struct ibv_wc	wc;
+	struct stat	st;
+	char		*host = NULL, *frag_path = NULL, *out_path = NULL;
+	uint8_t		*frag = NULL;
+	uint32_t	coef = 0;
+	size_t		size = 0, off, len;
+	int		listen = 0, has_coef = 0, slices, slot, i, opt;
+	int		out_fd = -1, fd;
+
+	ec_method_initialize();
+
+	while ((opt = getopt(argc, argv, "s:ln:f:c:o:C:")) != -1) {
+		switch (opt) {
+		case 's':
+			size = strtoull(optarg, NULL, 0);
+			break;
+		case 'l':
+			listen = 1;
+			break;
+		case 'n':
+			host = optarg;
+			break;
+		case 'f':
+			frag_path = optarg;
+			break;
+		case 'c':
+			coef = atoi(optarg);
+			has_coef = 1;
+			break;
+		case 'o':
+			out_path = optarg;
+			break;
+		case 'C':
+			if (argc - optind != COLUMN) {
+				usage(argv[0]);
+				return 1;
+			}
+			return print_coefficients(atoi(optarg), argv + optind);
+		default:
+			usage(argv[0]);
+			return 1;
+		}
+	}
+	if (size == 0 || size % EC_METHOD_CHUNK_SIZE || coef >= 256 ||
+	    !host == !out_path || (!listen && !frag_path) ||
+	    !frag_path != !has_coef) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	if (frag_path) {
+		fd = open(frag_path, O_RDONLY);
+		if (fd < 0)
+			return 1;
+		if (fstat(fd, &st) || (size_t)st.st_size < size) {
+			fprintf(stderr, "%s: shorter than %zu bytes\n",
+				frag_path, size);
+			return 1;
+		}
+		frag = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if (frag == MAP_FAILED)
+			return 1;
+		madvise(frag, size, MADV_SEQUENTIAL);
+	}
+	if (out_path) {
+		out_fd = open(out_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (out_fd < 0)
+			return 1;
+	}
+
+	ring = mmap(NULL, (size_t)SLOTS * SLICE, PROT_READ | PROT_WRITE,
+		    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (ring == MAP_FAILED)
+		return 1;
+
+	cm_channel = rdma_create_event_channel();
+	if (!cm_channel)
+		return 1;
+
+	slices = (size + SLICE - 1) / SLICE;
+	if (host && connect_next(&next, host))
+		return 1;
+	if (listen && accept_prev(&prev, slices))
+		return 1;
+
+	start_timer();
+	for (i = 0, off = 0; i < slices; i++, off += len) {
+		slot = i % SLOTS;
+		len = size - off < SLICE ? size - off : SLICE;
+
+		if (i >= SLOTS && host) {
+			/* Slice i - SLOTS has left: its slot is free. */
+			if (wait_slot(&next, &wc))
+				return 1;
+			if (listen && post_slot(&prev, slot))
+				return 1;
+		}
+
+		if (listen) {
+			if (wait_slot(&prev, &wc) || wc.byte_len != len)
+				return 1;
+		} else {
+			memset(ring + (size_t)slot * SLICE, 0, len);
+		}
+
+		if (frag)
+			ec_method_partial(len, coef, frag + off,
+					  (uint8_t *)ring + (size_t)slot * SLICE);
+
+		if (host) {
+			if (send_slot(&next, slot, len))
+				return 1;
+		} else {
+			if (pwrite(out_fd, ring + (size_t)slot * SLICE, len,
+				   off) != len)
+				return 1;
+			if (listen && i + SLOTS < slices &&
+			    post_slot(&prev, slot))
+				return 1;
+		}
+	}
+	for (i = slices > SLOTS ? slices - SLOTS : 0; host && i < slices; i++)
+		if (wait_slot(&next, &wc))
+			return 1;
+	print_timer();
+
+	if (out_fd >= 0 && close(out_fd))
+		return 1;
+
+	return 0;
+}
@@ -0,0 +1,409 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+#include <sys/sysinfo.h>
+
+#include "ec-method.h"
+#include "ec-method16.h"
+#include "ec-lrc.h"
+#include "ec-stream.h"
+
+/* Kernel benchmark: encodes and decodes BENCH_SIZE bytes for several code
+   widths and prefetch distances and prints the throughput in GB/s of data
+   processed. It ends with a wide GF(2^16) code, with a check of the
+   streaming encoder against the batch encoder, with the repair of one
+   fragment by a locally repairable layout, against the plain code, and
+   with checks of the corruptions found by ec_method_decode_verify. */
+
+#define BENCH_SIZE (1 << 28)
+#define BENCH_ROWS 4
+/* Wide GF(2^16) stripe. */
+#define BENCH16_COLUMNS 200
+#define BENCH16_ROWS 60
+/* Locally repairable layout: 16 columns in 4 groups, 2 global parities. */
+#define BENCHLRC_COLUMNS 16
+#define BENCHLRC_GROUPS 4
+#define BENCHLRC_GLOBALS 2
+/* Streaming encoder: input fed in uneven pieces, with a partial last
+   stripe, through a window of BENCHSTREAM_STRIPES stripes. */
+#define BENCHSTREAM_COLUMNS 16
+#define BENCHSTREAM_ROWS 24
+#define BENCHSTREAM_STRIPES 64
+#define BENCHSTREAM_PIECE 100003
+/* Verified decode: 16 columns and 4 redundant fragments, enough to tell
+   which source fragment is corrupted. Bytes are flipped in one stripe. */
+#define BENCHVERIFY_COLUMNS 16
+#define BENCHVERIFY_ROWS 4
+#define BENCHVERIFY_STRIPES 64
+#define BENCHVERIFY_STRIPE 37
+
+struct benchstream {
+	uint8_t **frags;
+	size_t size;
+	int overflow;
+};
+
+static void benchstream_emit(void *data, uint32_t row, size_t offset,
+			     uint8_t *ptr, size_t size)
+{
+	struct benchstream *bs = data;
+
+	if (offset + size > bs->size) {
+		bs->overflow = 1;
+		return;
+	}
+	memcpy(bs->frags[row] + offset, ptr, size);
+}
+
+static double now(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+static int bench16(uint8_t *in, uint8_t *out, int threads)
+{
+	uint32_t k = BENCH16_COLUMNS, m = BENCH16_ROWS;
+	uint32_t rows[BENCH16_COLUMNS];
+	uint8_t *frags[BENCH16_COLUMNS + BENCH16_ROWS];
+	size_t size, frag;
+	double t, enc, dec;
+	uint32_t i;
+
+	ec_method16_initialize();
+
+	size = BENCH_SIZE / (EC_METHOD16_CHUNK_SIZE * k) *
+	       EC_METHOD16_CHUNK_SIZE * k;
+	frag = size / k;
+	for (i = 0; i < k + m; i++) {
+		frags[i] = malloc(frag);
+		if (frags[i] == NULL)
+			return 1;
+	}
+	for (i = 0; i < k; i++)
+		rows[i] = m + i;
+
+	t = now();
+	ec_method16_batch_parallel_encode(size, k, k + m, in, frags, threads);
+	enc = size / (now() - t) / 1e9;
+
+	t = now();
+	ec_method16_parallel_decode(frag, k, rows, frags + m, out, threads);
+	dec = size / (now() - t) / 1e9;
+
+	if (memcmp(in, out, size) != 0) {
+		printf("gf16 decode mismatch\n");
+		return 1;
+	}
+	printf("gf16 %u+%u %10.3f %10.3f\n", k, m, enc, dec);
+
+	for (i = 0; i < k + m; i++)
+		free(frags[i]);
+
+	return 0;
+}
+
+static int benchstream(uint8_t *in, int threads)
+{
+	uint32_t k = BENCHSTREAM_COLUMNS, m = BENCHSTREAM_ROWS;
+	uint8_t *frags[BENCHSTREAM_ROWS], *ref[BENCHSTREAM_ROWS];
+	struct benchstream bs;
+	ec_stream_t stream;
+	size_t size, padded, frag, off, len;
+	double t, enc;
+	uint8_t *pad;
+	uint32_t i;
+
+	/* Not a whole number of stripes. */
+	size = BENCH_SIZE / 4 + 1000;
+	padded = (size + EC_METHOD_CHUNK_SIZE * k - 1) /
+		 (EC_METHOD_CHUNK_SIZE * k) * EC_METHOD_CHUNK_SIZE * k;
+	frag = padded / k;
+
+	pad = calloc(1, padded);
+	if (pad == NULL)
+		return 1;
+	memcpy(pad, in, size);
+	for (i = 0; i < m; i++) {
+		frags[i] = malloc(frag);
+		ref[i] = malloc(frag);
+		if (frags[i] == NULL || ref[i] == NULL)
+			return 1;
+	}
+	ec_method_batch_encode(padded, k, m, pad, ref);
+
+	bs.frags = frags;
+	bs.size = frag;
+	bs.overflow = 0;
+	if (ec_stream_init(&stream, k, m, BENCHSTREAM_STRIPES, threads,
+			   benchstream_emit, &bs))
+		return 1;
+
+	t = now();
+	for (off = 0; off < size; off += len) {
+		len = size - off < BENCHSTREAM_PIECE ? size - off :
+						       BENCHSTREAM_PIECE;
+		ec_stream_feed(&stream, in + off, len);
+	}
+	if (ec_stream_finish(&stream) != frag || bs.overflow) {
+		printf("stream size mismatch\n");
+		return 1;
+	}
+	enc = size / (now() - t) / 1e9;
+
+	for (i = 0; i < m; i++) {
+		if (memcmp(frags[i], ref[i], frag) != 0) {
+			printf("stream mismatch row %u\n", i);
+			return 1;
+		}
+	}
+	printf("stream %u+%u %10.3f\n", k, m - k, enc);
+
+	for (i = 0; i < m; i++) {
+		free(frags[i]);
+		free(ref[i]);
+	}
+	free(pad);
+
+	return 0;
+}
+
+static int benchlrc(uint8_t *in, int threads)
+{
+	uint32_t sources[EC_METHOD_MAX_FRAGMENTS];
+	uint8_t *frags[EC_LRC_MAX_FRAGMENTS], *src[EC_METHOD_MAX_FRAGMENTS];
+	uint8_t *rebuilt;
+	uint32_t missing = 0, n, i;
+	size_t size, frag;
+	double t, local, global;
+	ec_lrc_t lrc;
+
+	if (ec_lrc_init(&lrc, BENCHLRC_COLUMNS, BENCHLRC_GROUPS,
+			BENCHLRC_GLOBALS))
+		return 1;
+
+	size = BENCH_SIZE / (EC_METHOD_CHUNK_SIZE * lrc.columns) *
+	       EC_METHOD_CHUNK_SIZE * lrc.columns;
+	frag = size / lrc.columns;
+	for (i = 0; i < ec_lrc_fragments(&lrc); i++) {
+		frags[i] = malloc(frag);
+		if (frags[i] == NULL)
+			return 1;
+	}
+	rebuilt = malloc(frag);
+	if (rebuilt == NULL)
+		return 1;
+	ec_lrc_encode(&lrc, size, in, frags, threads);
+
+	/* Fragment 0 from its group. */
+	n = ec_lrc_sources(&lrc, missing, sources);
+	for (i = 0; i < n; i++)
+		src[i] = frags[sources[i]];
+	t = now();
+	ec_lrc_repair(&lrc, frag, missing, src, rebuilt, threads);
+	local = now() - t;
+	if (memcmp(rebuilt, frags[missing], frag) != 0) {
+		printf("lrc repair mismatch\n");
+		return 1;
+	}
+
+	/* Same fragment from columns fragments, as the plain code does. */
+	for (i = 0; i < lrc.columns; i++) {
+		sources[i] = i + 1;
+		src[i] = frags[i + 1];
+	}
+	t = now();
+	ec_method_parallel_repair(frag, lrc.columns, sources, src, 1,
+				  &missing, &rebuilt, threads);
+	global = now() - t;
+	if (memcmp(rebuilt, frags[missing], frag) != 0) {
+		printf("repair mismatch\n");
+		return 1;
+	}
+
+	printf("lrc %u/%u+%u repair: local %u reads %.3f s, "
+	       "global %u reads %.3f s\n", lrc.columns, lrc.groups,
+	       lrc.globals, n, local, lrc.columns, global);
+
+	for (i = 0; i < ec_lrc_fragments(&lrc); i++)
+		free(frags[i]);
+	free(rebuilt);
+
+	return 0;
+}
+
+/* Runs ec_method_decode_verify on the fragments, with the byte at offset
+   off of fragments a and b (if not -1) flipped, and checks that it returns
+   res bytes, flags exactly those fragments when it succeeds, and rebuilds
+   the input. */
+static int benchverify_case(uint8_t **frags, uint8_t *in, uint8_t *out,
+			    size_t frag, size_t off, int a, int b, size_t res)
+{
+	uint32_t rows[BENCHVERIFY_COLUMNS + BENCHVERIFY_ROWS];
+	uint8_t bad[BENCHVERIFY_COLUMNS + BENCHVERIFY_ROWS];
+	uint32_t count = BENCHVERIFY_COLUMNS + BENCHVERIFY_ROWS, i;
+	size_t got;
+	int err = 0;
+
+	for (i = 0; i < count; i++)
+		rows[i] = i;
+	if (a >= 0)
+		frags[a][off] ^= 0x5a;
+	if (b >= 0)
+		frags[b][off] ^= 0xa5;
+
+	got = ec_method_decode_verify(frag, BENCHVERIFY_COLUMNS, count, rows,
+				      frags, out, bad);
+	if (got != res)
+		err = 1;
+	for (i = 0; res != 0 && i < count; i++)
+		if (bad[i] != (i == a || i == b))
+			err = 1;
+	if (res != 0 && memcmp(in, out, res) != 0)
+		err = 1;
+
+	if (a >= 0)
+		frags[a][off] ^= 0x5a;
+	if (b >= 0)
+		frags[b][off] ^= 0xa5;
+
+	return err;
+}
+
+static int benchverify(uint8_t *in, uint8_t *out)
+{
+	uint8_t *frags[BENCHVERIFY_COLUMNS + BENCHVERIFY_ROWS];
+	size_t frag = (size_t)BENCHVERIFY_STRIPES * EC_METHOD_CHUNK_SIZE;
+	size_t size = frag * BENCHVERIFY_COLUMNS;
+	size_t off = (size_t)BENCHVERIFY_STRIPE * EC_METHOD_CHUNK_SIZE + 100;
+	uint32_t i;
+	int err;
+
+	for (i = 0; i < BENCHVERIFY_COLUMNS + BENCHVERIFY_ROWS; i++) {
+		frags[i] = malloc(frag);
+		if (frags[i] == NULL)
+			return 1;
+	}
+	ec_method_batch_encode(size, BENCHVERIFY_COLUMNS,
+			       BENCHVERIFY_COLUMNS + BENCHVERIFY_ROWS, in,
+			       frags);
+
+	/* Clean; one spare; one source, still decoded; a source and the
+	   first spare in the same stripe, which no single fragment
+	   explains. */
+	err = benchverify_case(frags, in, out, frag, off, -1, -1, size);
+	if (!err)
+		err = benchverify_case(frags, in, out, frag, off,
+				       BENCHVERIFY_COLUMNS + 2, -1, size);
+	if (!err)
+		err = benchverify_case(frags, in, out, frag, off, 3, -1, size);
+	if (!err)
+		err = benchverify_case(frags, in, out, frag, off, 3,
+				       BENCHVERIFY_COLUMNS, 0);
+
+	for (i = 0; i < BENCHVERIFY_COLUMNS + BENCHVERIFY_ROWS; i++)
+		free(frags[i]);
+
+	if (err) {
+		printf("verify mismatch\n");
+		return 1;
+	}
+	printf("verify %u+%u ok\n", BENCHVERIFY_COLUMNS, BENCHVERIFY_ROWS);
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	static const uint32_t columns[] = { 4, 8, 16, 32 };
+	static const uint32_t distances[] = { 0, 1, 2, 4, 8 };
+	uint32_t rows[EC_METHOD_MAX_FRAGMENTS];
+	uint8_t *frags[EC_METHOD_MAX_FRAGMENTS];
+	uint8_t *in, *out;
+	int threads = 1;
+	size_t size, frag;
+	double t, enc, dec;
+	uint32_t c, d, i, k;
+
+	if (argc > 1)
+		threads = atoi(argv[1]);
+	if (threads <= 0)
+		threads = get_nprocs();
+
+	ec_method_initialize();
+
+	in = malloc(BENCH_SIZE);
+	out = malloc(BENCH_SIZE);
+	if (in == NULL || out == NULL)
+		return 1;
+	for (i = 0; i < BENCH_SIZE; i++)
+		in[i] = rand();
+
+	printf("kernels %s, %d byte chunks (format %d), threads %d, %d MiB, "
+	       "%d redundancy rows\n", ec_gf_isa, (int)EC_METHOD_CHUNK_SIZE,
+	       EC_METHOD_FORMAT, threads, BENCH_SIZE >> 20, BENCH_ROWS);
+	printf("%4s %8s %10s %10s\n", "k", "prefetch", "encode", "decode");
+
+	for (c = 0; c < sizeof(columns) / sizeof(columns[0]); c++) {
+		k = columns[c];
+		size = BENCH_SIZE / (EC_METHOD_CHUNK_SIZE * k) *
+		       EC_METHOD_CHUNK_SIZE * k;
+		frag = size / k;
+		for (i = 0; i < k + BENCH_ROWS; i++) {
+			frags[i] = malloc(frag);
+			if (frags[i] == NULL)
+				return 1;
+		}
+		/* Decode from the last k fragments. */
+		for (i = 0; i < k; i++)
+			rows[i] = BENCH_ROWS + i;
+
+		/* Warm up: fault in the fragments. */
+		ec_method_batch_parallel_encode(size, k, k + BENCH_ROWS, in,
+						frags, threads);
+		ec_method_parallel_decode(frag, k, rows, frags + BENCH_ROWS,
+					  out, threads);
+
+		for (d = 0; d < sizeof(distances) / sizeof(distances[0]); d++) {
+			ec_method_set_prefetch(distances[d]);
+
+			t = now();
+			ec_method_batch_parallel_encode(size, k, k + BENCH_ROWS,
+							in, frags, threads);
+			enc = size / (now() - t) / 1e9;
+
+			t = now();
+			ec_method_parallel_decode(frag, k, rows,
+						  frags + BENCH_ROWS, out,
+						  threads);
+			dec = size / (now() - t) / 1e9;
+
+			if (memcmp(in, out, size) != 0) {
+				printf("decode mismatch k=%u\n", k);
+				return 1;
+			}
+			printf("%4u %8u %10.3f %10.3f\n", k, distances[d], enc,
+			       dec);
+		}
+
+		for (i = 0; i < k + BENCH_ROWS; i++)
+			free(frags[i]);
+	}
+
+	if (bench16(in, out, threads) != 0)
+		return 1;
+	if (benchstream(in, threads) != 0)
+		return 1;
+	if (benchlrc(in, threads) != 0)
+		return 1;
+	if (benchverify(in, out) != 0)
+		return 1;
+
+	free(in);
+	free(out);
+
+	return 0;
+}
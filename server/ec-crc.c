@@ -0,0 +1,125 @@
+#include <string.h>
+#include <inttypes.h>
+
+#include "ec-crc.h"
+
+/* Reflected Castagnoli polynomial. */
+#define EC_CRC32C_POLY 0x82F63B78
+
+static uint32_t ec_crc32c_table[256];
+
+static uint32_t ec_crc32c_sw(uint32_t crc, const uint8_t * buf, size_t size)
+{
+    size_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        crc = ec_crc32c_table[(crc ^ buf[i]) & 0xFF] ^ (crc >> 8);
+    }
+
+    return crc;
+}
+
+#ifdef __x86_64__
+__attribute__((target("sse4.2")))
+static uint32_t ec_crc32c_hw(uint32_t crc, const uint8_t * buf, size_t size)
+{
+    uint64_t c = crc, w;
+    size_t i;
+
+    for (i = 0; i + sizeof(w) <= size; i += sizeof(w))
+    {
+        memcpy(&w, buf + i, sizeof(w));
+        c = __builtin_ia32_crc32di(c, w);
+    }
+    for (; i < size; i++)
+    {
+        c = __builtin_ia32_crc32qi(c, buf[i]);
+    }
+
+    return c;
+}
+
+/* The crc32 instruction has a latency of three cycles but can start one
+   per cycle, so independent buffers are interleaved to keep it busy. */
+__attribute__((target("sse4.2")))
+static void ec_crc32c_hw_multi(uint32_t * crc, uint8_t ** buf, size_t off,
+                               uint32_t count, size_t size)
+{
+    uint64_t c0, c1, c2, w0, w1, w2;
+    uint32_t n;
+    size_t i;
+
+    for (n = 0; n + 3 <= count; n += 3)
+    {
+        c0 = c1 = c2 = 0xFFFFFFFF;
+        for (i = 0; i + sizeof(w0) <= size; i += sizeof(w0))
+        {
+            memcpy(&w0, buf[n] + off + i, sizeof(w0));
+            memcpy(&w1, buf[n + 1] + off + i, sizeof(w1));
+            memcpy(&w2, buf[n + 2] + off + i, sizeof(w2));
+            c0 = __builtin_ia32_crc32di(c0, w0);
+            c1 = __builtin_ia32_crc32di(c1, w1);
+            c2 = __builtin_ia32_crc32di(c2, w2);
+        }
+        crc[n] = ~ec_crc32c_hw(c0, buf[n] + off + i, size - i);
+        crc[n + 1] = ~ec_crc32c_hw(c1, buf[n + 1] + off + i, size - i);
+        crc[n + 2] = ~ec_crc32c_hw(c2, buf[n + 2] + off + i, size - i);
+    }
+    for (; n < count; n++)
+    {
+        crc[n] = ~ec_crc32c_hw(0xFFFFFFFF, buf[n] + off, size);
+    }
+}
+#endif
+
+static uint32_t (* ec_crc32c_update)(uint32_t, const uint8_t *, size_t) =
+    ec_crc32c_sw;
+static int ec_crc32c_hw_present;
+
+void ec_crc32c_initialize(void)
+{
+    uint32_t i, b, crc;
+
+    for (i = 0; i < 256; i++)
+    {
+        crc = i;
+        for (b = 0; b < 8; b++)
+        {
+            crc = (crc >> 1) ^ (EC_CRC32C_POLY & -(crc & 1));
+        }
+        ec_crc32c_table[i] = crc;
+    }
+
+#ifdef __x86_64__
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2"))
+    {
+        ec_crc32c_update = ec_crc32c_hw;
+        ec_crc32c_hw_present = 1;
+    }
+#endif
+}
+
+uint32_t ec_crc32c(uint32_t crc, const uint8_t * buf, size_t size)
+{
+    return ~ec_crc32c_update(~crc, buf, size);
+}
+
+void ec_crc32c_multi(uint32_t * crc, uint8_t ** buf, size_t off,
+                     uint32_t count, size_t size)
+{
+    uint32_t n;
+
+#ifdef __x86_64__
+    if (ec_crc32c_hw_present)
+    {
+        ec_crc32c_hw_multi(crc, buf, off, count, size);
+        return;
+    }
+#endif
+    for (n = 0; n < count; n++)
+    {
+        crc[n] = ec_crc32c(0, buf[n] + off, size);
+    }
+}
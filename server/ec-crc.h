@@ -0,0 +1,21 @@
+#ifndef __EC_CRC_H__
+#define __EC_CRC_H__
+
+#include <stddef.h>
+#include <inttypes.h>
+
+/* CRC32C (Castagnoli) checksums of fragment chunks. The SSE4.2 crc32
+ * instruction is used when the CPU has it, a table otherwise; both give
+ * the same values. ec_crc32c_initialize must be called first; it is called
+ * by ec_method_initialize.
+ *
+ * crc is the value returned for the preceding bytes, or 0 for the first
+ * ones. */
+void ec_crc32c_initialize(void);
+uint32_t ec_crc32c(uint32_t crc, const uint8_t * buf, size_t size);
+/* crc[n] = ec_crc32c(0, buf[n] + off, size) for n < count. The buffers are
+   processed side by side, which is faster than one at a time. */
+void ec_crc32c_multi(uint32_t * crc, uint8_t ** buf, size_t off,
+                     uint32_t count, size_t size);
+
+#endif /* __EC_CRC_H__ */
@@ -0,0 +1,550 @@
+/* Generates the bit-sliced GF(2^8) kernels (ec-gf.c). Each multiplication
+ * by a constant is a linear map on the 8 bit planes; the generator builds
+ * the 8x8 matrix of the map and turns it into a sequence of xors, sharing
+ * common pairs of terms between the output planes (Paar's greedy
+ * algorithm).
+ *
+ * Every kernel is emitted once per word type: plain 64 bit words and, on
+ * x86-64, SSE2, AVX2 and AVX-512 vectors. The best set supported by the CPU
+ * is selected when the program starts.
+ *
+ * Arguments of the form k:m request a fused encoder for that code, which
+ * computes the m fragments of a stripe with the Horner kernels inlined.
+ *
+ * The result is printed on stdout as C code. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "ec-gf.h"
+
+#define GEN_MAX_SIGNALS 64
+
+struct gen_net
+{
+    uint32_t signals;
+    uint32_t first[GEN_MAX_SIGNALS];
+    uint32_t second[GEN_MAX_SIGNALS];
+    uint64_t outputs[EC_GF_BITS];
+};
+typedef struct gen_net gen_net_t;
+
+static uint32_t gen_mul(uint32_t a, uint32_t b)
+{
+    uint32_t r = 0;
+
+    while (b)
+    {
+        if (b & 1)
+        {
+            r ^= a;
+        }
+        b >>= 1;
+        a <<= 1;
+        if (a & EC_GF_SIZE)
+        {
+            a ^= EC_GF_MOD;
+        }
+    }
+
+    return r;
+}
+
+/* outputs[b] gets a bit for every input plane that is xor'ed into output
+ * plane b when multiplying by c. Signals 0..EC_GF_BITS-1 are the input
+ * planes; the following ones are intermediate xors. */
+static void gen_build(gen_net_t * net, uint32_t c)
+{
+    uint32_t i, j, k, b, count, best, best_i, best_j;
+
+    memset(net, 0, sizeof(*net));
+    net->signals = EC_GF_BITS;
+    for (j = 0; j < EC_GF_BITS; j++)
+    {
+        k = gen_mul(c, 1 << j);
+        for (b = 0; b < EC_GF_BITS; b++)
+        {
+            if (k & (1 << b))
+            {
+                net->outputs[b] |= 1ULL << j;
+            }
+        }
+    }
+
+    while (net->signals < GEN_MAX_SIGNALS)
+    {
+        best = 1;
+        best_i = best_j = 0;
+        for (i = 0; i < net->signals; i++)
+        {
+            for (j = i + 1; j < net->signals; j++)
+            {
+                count = 0;
+                for (b = 0; b < EC_GF_BITS; b++)
+                {
+                    if (((net->outputs[b] >> i) & 1) &&
+                        ((net->outputs[b] >> j) & 1))
+                    {
+                        count++;
+                    }
+                }
+                if (count > best)
+                {
+                    best = count;
+                    best_i = i;
+                    best_j = j;
+                }
+            }
+        }
+        if (best < 2)
+        {
+            break;
+        }
+
+        k = net->signals++;
+        net->first[k] = best_i;
+        net->second[k] = best_j;
+        for (b = 0; b < EC_GF_BITS; b++)
+        {
+            if (((net->outputs[b] >> best_i) & 1) &&
+                ((net->outputs[b] >> best_j) & 1))
+            {
+                net->outputs[b] &= ~((1ULL << best_i) | (1ULL << best_j));
+                net->outputs[b] |= 1ULL << k;
+            }
+        }
+    }
+}
+
+struct gen_isa
+{
+    const char * name;
+    const char * type;
+    uint32_t lanes;
+    const char * target;
+};
+typedef struct gen_isa gen_isa_t;
+
+static gen_isa_t gen_isas[] =
+{
+    { "64", "uint64_t", 1, NULL },
+    { "sse2", "ec_gf_v2_t", 2, "sse2" },
+    { "avx2", "ec_gf_v4_t", 4, "avx2" },
+    { "avx512", "ec_gf_v8_t", 8, "avx512f" }
+};
+
+#define GEN_ISAS (sizeof(gen_isas) / sizeof(gen_isas[0]))
+#define GEN_MAX_CODES 32
+
+static uint32_t gen_codes[GEN_MAX_CODES][2];
+static uint32_t gen_code_count;
+
+static void gen_signal(uint32_t signal)
+{
+    if (signal < EC_GF_BITS)
+    {
+        printf("in%u", signal);
+    }
+    else
+    {
+        printf("tmp%u", signal - EC_GF_BITS);
+    }
+}
+
+/* Prints the declarations and statements computing out0..outN from
+ * in0..inN, with the given indentation. */
+static void gen_network(gen_net_t * net, gen_isa_t * isa, const char * indent)
+{
+    uint32_t i, b, first;
+
+    printf("%s%s out0", indent, isa->type);
+    for (b = 1; b < EC_GF_BITS; b++)
+    {
+        printf(", out%u", b);
+    }
+    printf(";\n");
+    if (net->signals > EC_GF_BITS)
+    {
+        printf("%s%s tmp0", indent, isa->type);
+        for (i = EC_GF_BITS + 1; i < net->signals; i++)
+        {
+            printf(", tmp%u", i - EC_GF_BITS);
+        }
+        printf(";\n");
+    }
+    printf("\n");
+
+    for (i = EC_GF_BITS; i < net->signals; i++)
+    {
+        printf("%s", indent);
+        gen_signal(i);
+        printf(" = ");
+        gen_signal(net->first[i]);
+        printf(" ^ ");
+        gen_signal(net->second[i]);
+        printf(";\n");
+    }
+    for (b = 0; b < EC_GF_BITS; b++)
+    {
+        printf("%sout%u = ", indent, b);
+        if (net->outputs[b] == 0)
+        {
+            printf("in%u ^ in%u", b, b);
+        }
+        first = 1;
+        for (i = 0; i < net->signals; i++)
+        {
+            if ((net->outputs[b] >> i) & 1)
+            {
+                printf(first ? "" : " ^ ");
+                gen_signal(i);
+                first = 0;
+            }
+        }
+        printf(";\n");
+    }
+}
+
+static void gen_plane(uint32_t b)
+{
+    if (b == 0)
+    {
+        printf("[0]");
+    }
+    else if (b == 1)
+    {
+        printf("[width]");
+    }
+    else
+    {
+        printf("[width * %u]", b);
+    }
+}
+
+static void gen_prologue(gen_isa_t * isa, const char * inline_attr)
+{
+    if (isa->target != NULL)
+    {
+        printf("__attribute__((target(\"%s\")%s))\n", isa->target,
+               inline_attr);
+    }
+    else if (inline_attr[0] != 0)
+    {
+        printf("__attribute__((%s))\n", inline_attr + 2);
+    }
+}
+
+static void gen_width(gen_isa_t * isa)
+{
+    if (isa->lanes > 1)
+    {
+        printf("    width /= %u;\n", isa->lanes);
+    }
+}
+
+/* out = out * c + in */
+static void gen_muladd(gen_isa_t * isa, uint32_t c)
+{
+    gen_net_t net;
+    uint32_t b;
+
+    gen_prologue(isa, "");
+    printf("static void gf8_muladd_%s_%02X(uint8_t * out, uint8_t * in,\n"
+           "                              unsigned int width)\n"
+           "{\n", isa->name, c);
+    if (c == 0)
+    {
+        printf("    memcpy(out, in, sizeof(uint64_t) * %u * width);\n"
+               "}\n\n", EC_GF_BITS);
+        return;
+    }
+
+    gen_build(&net, c);
+
+    printf("    unsigned int i;\n"
+           "    %s * in_ptr = (%s *)in;\n"
+           "    %s * out_ptr = (%s *)out;\n\n",
+           isa->type, isa->type, isa->type, isa->type);
+    gen_width(isa);
+    printf("    for (i = 0; i < width; i++)\n"
+           "    {\n");
+    for (b = 0; b < EC_GF_BITS; b++)
+    {
+        printf("        %s in%u = out_ptr", isa->type, b);
+        gen_plane(b);
+        printf(";\n");
+    }
+    gen_network(&net, isa, "        ");
+    printf("\n");
+    for (b = 0; b < EC_GF_BITS; b++)
+    {
+        printf("        out_ptr");
+        gen_plane(b);
+        printf(" = out%u ^ in_ptr", b);
+        gen_plane(b);
+        printf(";\n");
+    }
+    printf("\n"
+           "        in_ptr++;\n"
+           "        out_ptr++;\n"
+           "    }\n"
+           "}\n\n");
+}
+
+/* out = in[0] * c^(columns-1) + in[1] * c^(columns-2) + ... +
+ * in[columns-1], evaluated with the accumulator kept in registers. in
+ * points to columns consecutive chunks. */
+static void gen_horner(gen_isa_t * isa, uint32_t c)
+{
+    gen_net_t net;
+    uint32_t b;
+
+    gen_build(&net, c);
+
+    gen_prologue(isa, ", always_inline");
+    printf("static inline void gf8_horner_%s_%02X(uint8_t * out, uint8_t * in,\n"
+           "                                     unsigned int columns,\n"
+           "                                     unsigned int width)\n",
+           isa->name, c);
+    printf("{\n"
+           "    unsigned int i, j;\n"
+           "    %s * in_ptr = (%s *)in;\n"
+           "    %s * out_ptr = (%s *)out;\n\n",
+           isa->type, isa->type, isa->type, isa->type);
+    gen_width(isa);
+    printf("    for (i = 0; i < width; i++)\n"
+           "    {\n"
+           "        %s * ptr = in_ptr;\n", isa->type);
+    for (b = 0; b < EC_GF_BITS; b++)
+    {
+        printf("        %s in%u = ptr", isa->type, b);
+        gen_plane(b);
+        printf(";\n");
+    }
+    printf("\n"
+           "        for (j = 1; j < columns; j++)\n"
+           "        {\n");
+    gen_network(&net, isa, "            ");
+    printf("\n"
+           "            ptr += width * %u;\n", EC_GF_BITS);
+    for (b = 0; b < EC_GF_BITS; b++)
+    {
+        printf("            in%u = out%u ^ ptr", b, b);
+        gen_plane(b);
+        printf(";\n");
+    }
+    printf("        }\n\n");
+    for (b = 0; b < EC_GF_BITS; b++)
+    {
+        printf("        out_ptr");
+        gen_plane(b);
+        printf(" = in%u;\n", b);
+    }
+    printf("\n"
+           "        in_ptr++;\n"
+           "        out_ptr++;\n"
+           "    }\n"
+           "}\n\n");
+}
+
+/* Encodes one stripe of a columns + rows code: fragment r gets the Horner
+ * chain of the stripe with multiplier r + 1. */
+static void gen_code(gen_isa_t * isa, uint32_t columns, uint32_t rows)
+{
+    uint32_t r;
+
+    gen_prologue(isa, "");
+    printf("static void gf8_code_%s_%u_%u(uint8_t ** out, size_t off, "
+           "uint8_t * in,\n"
+           "                              unsigned int width)\n"
+           "{\n", isa->name, columns, rows);
+    for (r = 0; r < rows; r++)
+    {
+        printf("    gf8_horner_%s_%02X(out[%u] + off, in, %u, width);\n",
+               isa->name, r + 1, r, columns);
+    }
+    printf("}\n\n");
+}
+
+static void gen_table(gen_isa_t * isa, const char * kind, const char * args)
+{
+    uint32_t c;
+
+    printf("static void (* const gf8_%s_%s[])(%s) =\n{", kind, isa->name,
+           args);
+    for (c = 0; c < EC_GF_SIZE; c++)
+    {
+        printf("%sgf8_%s_%s_%02X", (c % 4) ? ", " : (c ? ",\n    " : "\n    "),
+               kind, isa->name, c);
+    }
+    printf("\n};\n\n");
+}
+
+#define GEN_MULADD_ARGS "uint8_t * out, uint8_t * in, unsigned int width"
+#define GEN_HORNER_ARGS "uint8_t * out, uint8_t * in, unsigned int columns,\n" \
+                        "                                unsigned int width"
+
+static void gen_isa(gen_isa_t * isa)
+{
+    uint32_t c, i;
+
+    if (isa->target != NULL)
+    {
+        printf("#ifdef __x86_64__\n\n");
+    }
+    for (c = 0; c < EC_GF_SIZE; c++)
+    {
+        gen_muladd(isa, c);
+    }
+    for (c = 0; c < EC_GF_SIZE; c++)
+    {
+        gen_horner(isa, c);
+    }
+    for (i = 0; i < gen_code_count; i++)
+    {
+        gen_code(isa, gen_codes[i][0], gen_codes[i][1]);
+    }
+
+    gen_table(isa, "muladd", GEN_MULADD_ARGS);
+    gen_table(isa, "horner", GEN_HORNER_ARGS);
+    printf("static ec_gf_code_t gf8_codes_%s[] =\n{\n", isa->name);
+    for (i = 0; i < gen_code_count; i++)
+    {
+        printf("    { %u, %u, gf8_code_%s_%u_%u },\n", gen_codes[i][0],
+               gen_codes[i][1], isa->name, gen_codes[i][0], gen_codes[i][1]);
+    }
+    printf("    { 0, 0, NULL }\n"
+           "};\n\n");
+    if (isa->target != NULL)
+    {
+        printf("#endif\n\n");
+    }
+}
+
+static void gen_select(void)
+{
+    uint32_t i;
+
+    printf("void (* ec_gf_muladd[EC_GF_SIZE])(" GEN_MULADD_ARGS ");\n"
+           "void (* ec_gf_horner[EC_GF_SIZE])(" GEN_HORNER_ARGS ");\n"
+           "static ec_gf_code_t * ec_gf_codes;\n"
+           "const char * ec_gf_isa;\n\n");
+
+    printf("#define EC_GF_USE(isa) \\\n"
+           "    do \\\n"
+           "    { \\\n"
+           "        memcpy(ec_gf_muladd, gf8_muladd_##isa, "
+           "sizeof(ec_gf_muladd)); \\\n"
+           "        memcpy(ec_gf_horner, gf8_horner_##isa, "
+           "sizeof(ec_gf_horner)); \\\n"
+           "        ec_gf_codes = gf8_codes_##isa; \\\n"
+           "        ec_gf_isa = #isa; \\\n"
+           "    } while (0)\n\n");
+
+    /* The isa can be forced with EC_GF_ISA, e.g. to compare them. An isa
+       the CPU does not support is ignored, instead of faulting on the first
+       kernel call. */
+    printf("static void __attribute__((constructor)) ec_gf_select(void)\n"
+           "{\n"
+           "    const char * isa = getenv(\"EC_GF_ISA\");\n\n"
+           "    EC_GF_USE(64);\n"
+           "    if ((isa != NULL) && (*isa == 0))\n"
+           "    {\n"
+           "        isa = NULL;\n"
+           "    }\n"
+           "    if ((isa != NULL) && (strcmp(isa, \"64\") == 0))\n"
+           "    {\n"
+           "        return;\n"
+           "    }\n"
+           "#ifdef __x86_64__\n"
+           "    __builtin_cpu_init();\n"
+           "    if (isa != NULL)\n"
+           "    {\n");
+    for (i = GEN_ISAS; i > 1; i--)
+    {
+        printf("        if ((strcmp(isa, \"%s\") == 0) &&\n"
+               "            __builtin_cpu_supports(\"%s\"))\n"
+               "        {\n"
+               "            EC_GF_USE(%s);\n"
+               "            return;\n"
+               "        }\n",
+               gen_isas[i - 1].name, gen_isas[i - 1].target,
+               gen_isas[i - 1].name);
+    }
+    printf("    }\n"
+           "#endif\n"
+           "    if (isa != NULL)\n"
+           "    {\n"
+           "        fprintf(stderr, \"EC_GF_ISA=%%s is not supported here, \"\n"
+           "                        \"using the best available kernels\\n\", isa);\n"
+           "    }\n"
+           "#ifdef __x86_64__\n");
+    for (i = GEN_ISAS; i > 1; i--)
+    {
+        printf("    %sif (__builtin_cpu_supports(\"%s\"))\n"
+               "    {\n"
+               "        EC_GF_USE(%s);\n"
+               "    }\n",
+               (i == GEN_ISAS) ? "" : "else ", gen_isas[i - 1].target,
+               gen_isas[i - 1].name);
+    }
+    printf("#endif\n"
+           "}\n\n");
+
+    printf("ec_gf_encode_t ec_gf_code(uint32_t columns, uint32_t rows)\n"
+           "{\n"
+           "    ec_gf_code_t * code;\n\n"
+           "    for (code = ec_gf_codes; code->encode != NULL; code++)\n"
+           "    {\n"
+           "        if ((code->columns == columns) && (code->rows == rows))\n"
+           "        {\n"
+           "            return code->encode;\n"
+           "        }\n"
+           "    }\n\n"
+           "    return NULL;\n"
+           "}\n");
+}
+
+int main(int argc, char * argv[])
+{
+    uint32_t i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((gen_code_count == GEN_MAX_CODES) ||
+            (sscanf(argv[i], "%u:%u", &gen_codes[gen_code_count][0],
+                    &gen_codes[gen_code_count][1]) != 2) ||
+            (gen_codes[gen_code_count][0] < 1) ||
+            (gen_codes[gen_code_count][1] >= EC_GF_SIZE))
+        {
+            fprintf(stderr, "usage: %s [columns:rows ...]\n", argv[0]);
+            return 1;
+        }
+        gen_code_count++;
+    }
+
+    printf("/* Generated by ec-gf-gen. Do not edit. */\n\n"
+           "#include <stdio.h>\n"
+           "#include <stdlib.h>\n"
+           "#include <string.h>\n"
+           "#include <inttypes.h>\n\n"
+           "#include \"ec-gf.h\"\n\n"
+           "#ifdef __x86_64__\n"
+           "typedef long long ec_gf_v2_t __attribute__((vector_size(16), "
+           "aligned(8)));\n"
+           "typedef long long ec_gf_v4_t __attribute__((vector_size(32), "
+           "aligned(8)));\n"
+           "typedef long long ec_gf_v8_t __attribute__((vector_size(64), "
+           "aligned(8)));\n"
+           "#endif\n\n");
+
+    for (i = 0; i < GEN_ISAS; i++)
+    {
+        gen_isa(&gen_isas[i]);
+    }
+    gen_select();
+
+    return 0;
+}
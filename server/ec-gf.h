@@ -15,9 +15,37 @@
 
 #define EC_GF_SIZE (1 << EC_GF_BITS)
 #define EC_GF_WORD_SIZE sizeof(uint64_t)
+#include <stddef.h>
 #include <inttypes.h>
 
+/* The kernels are generated by ec-gf-gen. width is the number of 64 bit
+   words of each bit plane; it must be a multiple of 8 so that any of the
+   vector kernel sets can be selected. */
 extern void (* ec_gf_muladd[])(uint8_t * out, uint8_t * in,
                                unsigned int width);
+/* Multiplies by the index the Horner chain of 'columns' consecutive chunks
+   at in and stores the result in out. */
+extern void (* ec_gf_horner[])(uint8_t * out, uint8_t * in,
+                               unsigned int columns, unsigned int width);
+
+/* Fused encoder for one stripe of a given code: out[r] + off receives the
+   fragment chunk of row r for all rows of the code. */
+typedef void (* ec_gf_encode_t)(uint8_t ** out, size_t off, uint8_t * in,
+                                unsigned int width);
+
+struct ec_gf_code
+{
+    uint32_t columns;
+    uint32_t rows;
+    ec_gf_encode_t encode;
+};
+typedef struct ec_gf_code ec_gf_code_t;
+
+/* Returns the fused encoder generated for a columns + rows code, or NULL.
+   The codes are selected with EC_GF_CODES in the Makefile. */
+ec_gf_encode_t ec_gf_code(uint32_t columns, uint32_t rows);
+
+/* Name of the kernel set in use ("64", "sse2", "avx2" or "avx512"). */
+extern const char * ec_gf_isa;
 
 #endif /* __EC_GF8_H__ */
@@ -0,0 +1,169 @@
+/*
+  Copyright (c) 2012-2014 DataLab, s.l. <http://www.datalab.es>
+  This file is part of GlusterFS.
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+#include <string.h>
+#include <inttypes.h>
+
+#include "ec-gf16.h"
+
+/* Number of words of each plane processed at once. A block of every plane
+   is kept in ec_gf16_v_t variables, which map to vector registers. */
+#define EC_GF16_BLOCK 8
+
+typedef uint64_t ec_gf16_v_t
+    __attribute__((vector_size(EC_GF16_BLOCK * sizeof(uint64_t)),
+                   aligned(8)));
+
+/* The kernels are built for each of these targets; the best one for the
+   CPU is selected when the program is loaded. */
+#ifdef __x86_64__
+#define EC_GF16_CLONES \
+    __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define EC_GF16_CLONES
+#endif
+
+void ec_gf16_matrix(uint32_t c, uint16_t * mask)
+{
+    uint32_t a, b;
+
+    memset(mask, 0, sizeof(uint16_t) * EC_GF16_BITS);
+    for (a = 0; a < EC_GF16_BITS; a++)
+    {
+        for (b = 0; b < EC_GF16_BITS; b++)
+        {
+            if ((c >> b) & 1)
+            {
+                mask[b] |= 1 << a;
+            }
+        }
+        c <<= 1;
+        if (c >= EC_GF16_SIZE)
+        {
+            c ^= EC_GF16_MOD;
+        }
+    }
+}
+
+/* Block of plane b of the chunk whose plane 0 block is at ptr. */
+#define EC_GF16_PLANE(ptr, b, width) \
+    (*(ec_gf16_v_t *)((ptr) + (size_t)(b) * (width)))
+
+/* y = x * c + in for one block of all planes. */
+static inline void ec_gf16_block(ec_gf16_v_t * y, ec_gf16_v_t * x,
+                                 uint16_t * mask, uint64_t * in,
+                                 unsigned int width)
+{
+    uint32_t b, m;
+
+    for (b = 0; b < EC_GF16_BITS; b++)
+    {
+        y[b] = EC_GF16_PLANE(in, b, width);
+        for (m = mask[b]; m != 0; m &= m - 1)
+        {
+            y[b] ^= x[__builtin_ctz(m)];
+        }
+    }
+}
+
+EC_GF16_CLONES
+void ec_gf16_muladd(uint8_t * out, uint8_t * in, uint32_t c,
+                    unsigned int width)
+{
+    ec_gf16_v_t x[EC_GF16_BITS], y[EC_GF16_BITS];
+    uint64_t * in_ptr = (uint64_t *)in;
+    uint64_t * out_ptr = (uint64_t *)out;
+    uint16_t mask[EC_GF16_BITS];
+    unsigned int i;
+    uint32_t b;
+
+    if (c == 0)
+    {
+        memcpy(out, in, sizeof(uint64_t) * EC_GF16_BITS * width);
+        return;
+    }
+
+    ec_gf16_matrix(c, mask);
+    for (i = 0; i < width; i += EC_GF16_BLOCK)
+    {
+        for (b = 0; b < EC_GF16_BITS; b++)
+        {
+            x[b] = EC_GF16_PLANE(out_ptr + i, b, width);
+        }
+        ec_gf16_block(y, x, mask, in_ptr + i, width);
+        for (b = 0; b < EC_GF16_BITS; b++)
+        {
+            EC_GF16_PLANE(out_ptr + i, b, width) = y[b];
+        }
+    }
+}
+
+EC_GF16_CLONES
+void ec_gf16_horner(uint8_t * out, uint8_t * in, uint32_t c,
+                    unsigned int columns, unsigned int width)
+{
+    ec_gf16_v_t acc[2][EC_GF16_BITS];
+    uint64_t * in_ptr = (uint64_t *)in;
+    uint64_t * out_ptr = (uint64_t *)out;
+    uint64_t * ptr;
+    uint16_t mask[EC_GF16_BITS];
+    unsigned int i, j;
+    uint32_t b;
+
+    ec_gf16_matrix(c, mask);
+    for (i = 0; i < width; i += EC_GF16_BLOCK)
+    {
+        ptr = in_ptr + i;
+        for (b = 0; b < EC_GF16_BITS; b++)
+        {
+            acc[0][b] = EC_GF16_PLANE(ptr, b, width);
+        }
+        for (j = 1; j < columns; j++)
+        {
+            ptr += width * EC_GF16_BITS;
+            ec_gf16_block(acc[j & 1], acc[(j - 1) & 1], mask, ptr, width);
+        }
+        for (b = 0; b < EC_GF16_BITS; b++)
+        {
+            EC_GF16_PLANE(out_ptr + i, b, width) = acc[(columns - 1) & 1][b];
+        }
+    }
+}
+
+EC_GF16_CLONES
+void ec_gf16_dot(uint8_t * out, uint8_t ** in, size_t off, uint16_t * masks,
+                 unsigned int count, unsigned int width)
+{
+    ec_gf16_v_t y[EC_GF16_BITS];
+    uint64_t * out_ptr = (uint64_t *)out;
+    uint64_t * ptr;
+    uint16_t * mask;
+    uint32_t b, m;
+    unsigned int i, j;
+
+    for (i = 0; i < width; i += EC_GF16_BLOCK)
+    {
+        memset(y, 0, sizeof(y));
+        for (j = 0; j < count; j++)
+        {
+            ptr = (uint64_t *)(in[j] + off) + i;
+            mask = masks + j * EC_GF16_BITS;
+            for (b = 0; b < EC_GF16_BITS; b++)
+            {
+                for (m = mask[b]; m != 0; m &= m - 1)
+                {
+                    y[b] ^= EC_GF16_PLANE(ptr, __builtin_ctz(m), width);
+                }
+            }
+        }
+        for (b = 0; b < EC_GF16_BITS; b++)
+        {
+            EC_GF16_PLANE(out_ptr + i, b, width) = y[b];
+        }
+    }
+}
@@ -0,0 +1,44 @@
+/*
+  Copyright (c) 2012-2014 DataLab, s.l. <http://www.datalab.es>
+  This file is part of GlusterFS.
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#ifndef __EC_GF16_H__
+#define __EC_GF16_H__
+
+#define EC_GF16_BITS 16
+#define EC_GF16_MOD 0x1100B
+
+#define EC_GF16_SIZE (1 << EC_GF16_BITS)
+#include <stddef.h>
+#include <inttypes.h>
+
+/* GF(2^16) counterpart of the ec_gf_muladd and ec_gf_horner kernels. A
+   chunk has EC_GF16_BITS planes of width 64 bit words, width being a
+   multiple of 8. With 65535 coefficients there cannot be one generated
+   kernel per coefficient, so the coefficient is an argument and the
+   kernels apply the bit matrix of the multiplication by it. */
+
+/* Multiplying by c is linear over the bits of a symbol: bit b of x * c is
+   the xor of the bits a of x for which bit b of c * 2^a is set. mask[b]
+   receives the set of those a. */
+void ec_gf16_matrix(uint32_t c, uint16_t * mask);
+
+/* out = out * c + in */
+void ec_gf16_muladd(uint8_t * out, uint8_t * in, uint32_t c,
+                    unsigned int width);
+/* Stores in out the Horner chain with multiplier c of 'columns'
+   consecutive chunks at in. */
+void ec_gf16_horner(uint8_t * out, uint8_t * in, uint32_t c,
+                    unsigned int columns, unsigned int width);
+/* out = in[0] * c[0] + ... + in[count - 1] * c[count - 1], reading the
+   chunks at in[j] + off. masks holds the ec_gf16_matrix of every c[j];
+   keeping the sum in a local block avoids rewriting out for each term. */
+void ec_gf16_dot(uint8_t * out, uint8_t ** in, size_t off, uint16_t * masks,
+                 unsigned int count, unsigned int width);
+
+#endif /* __EC_GF16_H__ */
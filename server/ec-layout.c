@@ -0,0 +1,127 @@
+#include <string.h>
+#include <inttypes.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "ec-gf.h"
+#include "ec-method.h"
+#include "ec-layout.h"
+
+/* Transposes an 8x8 bit matrix stored as bit (8 * row + col) of x. */
+static inline uint64_t ec_layout_transpose8(uint64_t x)
+{
+    uint64_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+    x ^= t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+    x ^= t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+    x ^= t ^ (t << 28);
+
+    return x;
+}
+
+static void ec_layout_chunk_to_bytes(uint8_t * out, uint64_t * in)
+{
+    uint32_t w, q, b;
+    uint64_t x;
+
+    for (w = 0; w < EC_METHOD_WIDTH; w++)
+    {
+        for (q = 0; q < EC_GF_WORD_SIZE; q++)
+        {
+            x = 0;
+            for (b = 0; b < EC_GF_BITS; b++)
+            {
+                x |= ((in[b * EC_METHOD_WIDTH + w] >> (q * 8)) & 0xFF) <<
+                     (b * 8);
+            }
+            x = ec_layout_transpose8(x);
+            memcpy(out, &x, sizeof(x));
+            out += sizeof(x);
+        }
+    }
+}
+
+#ifdef __SSE2__
+
+/* Each movemask extracts the top bit of 16 symbols at once, which is 16
+ * consecutive bits of one plane. Adding the vector to itself moves the
+ * next bit up. */
+static void ec_layout_chunk_from_bytes(uint64_t * out, uint8_t * in)
+{
+    uint32_t w, h, b;
+    __m128i v;
+
+    memset(out, 0, EC_METHOD_CHUNK_SIZE);
+    for (w = 0; w < EC_METHOD_WIDTH; w++)
+    {
+        for (h = 0; h < 4; h++)
+        {
+            v = _mm_loadu_si128((__m128i *)in);
+            for (b = EC_GF_BITS; b > 0; b--)
+            {
+                out[(b - 1) * EC_METHOD_WIDTH + w] |=
+                    (uint64_t)(uint16_t)_mm_movemask_epi8(v) << (h * 16);
+                v = _mm_add_epi8(v, v);
+            }
+            in += 16;
+        }
+    }
+}
+
+#else
+
+static void ec_layout_chunk_from_bytes(uint64_t * out, uint8_t * in)
+{
+    uint32_t w, q, b;
+    uint64_t x;
+
+    memset(out, 0, EC_METHOD_CHUNK_SIZE);
+    for (w = 0; w < EC_METHOD_WIDTH; w++)
+    {
+        for (q = 0; q < EC_GF_WORD_SIZE; q++)
+        {
+            memcpy(&x, in, sizeof(x));
+            in += sizeof(x);
+            x = ec_layout_transpose8(x);
+            for (b = 0; b < EC_GF_BITS; b++)
+            {
+                out[b * EC_METHOD_WIDTH + w] |= ((x >> (b * 8)) & 0xFF) <<
+                                                (q * 8);
+            }
+        }
+    }
+}
+
+#endif
+
+void ec_layout_to_bytes(uint8_t * out, uint8_t * in, size_t size)
+{
+    uint64_t tmp[EC_METHOD_CHUNK_SIZE / sizeof(uint64_t)];
+
+    size /= EC_METHOD_CHUNK_SIZE;
+    while (size-- > 0)
+    {
+        memcpy(tmp, in, EC_METHOD_CHUNK_SIZE);
+        ec_layout_chunk_to_bytes(out, tmp);
+        in += EC_METHOD_CHUNK_SIZE;
+        out += EC_METHOD_CHUNK_SIZE;
+    }
+}
+
+void ec_layout_from_bytes(uint8_t * out, uint8_t * in, size_t size)
+{
+    uint64_t tmp[EC_METHOD_CHUNK_SIZE / sizeof(uint64_t)];
+
+    size /= EC_METHOD_CHUNK_SIZE;
+    while (size-- > 0)
+    {
+        ec_layout_chunk_from_bytes(tmp, in);
+        memcpy(out, tmp, EC_METHOD_CHUNK_SIZE);
+        in += EC_METHOD_CHUNK_SIZE;
+        out += EC_METHOD_CHUNK_SIZE;
+    }
+}
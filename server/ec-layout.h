@@ -0,0 +1,20 @@
+#ifndef __EC_LAYOUT_H__
+#define __EC_LAYOUT_H__
+
+#include <stddef.h>
+#include <inttypes.h>
+
+/* Conversion between the bit-plane chunk layout used by the ec_gf_muladd
+ * kernels and a byte-wise layout where every byte is one GF(2^8) symbol.
+ *
+ * Inside a chunk, bit t of word w in plane b holds bit b of symbol
+ * (w * 64 + t). Fragments converted to byte layout are identical to what
+ * a byte-wise Reed-Solomon codec using the same field and matrix produces
+ * from byte-wise data.
+ *
+ * size must be a multiple of EC_METHOD_CHUNK_SIZE. in and out may be the
+ * same buffer. */
+void ec_layout_to_bytes(uint8_t * out, uint8_t * in, size_t size);
+void ec_layout_from_bytes(uint8_t * out, uint8_t * in, size_t size);
+
+#endif /* __EC_LAYOUT_H__ */
@@ -0,0 +1,287 @@
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "ec-gf.h"
+#include "ec-method.h"
+#include "ec-sched.h"
+#include "ec-lrc.h"
+
+/* Stripes encoded by each task of ec_lrc_encode. The fragments of a task
+   are still in cache when its local parities are computed. */
+#define EC_LRC_ENCODE_GRAIN 16
+/* Chunks xor'ed by each task of a local repair. */
+#define EC_LRC_REPAIR_GRAIN 256
+
+int ec_lrc_init(ec_lrc_t * lrc, uint32_t columns, uint32_t groups,
+                uint32_t globals)
+{
+    if ((columns == 0) || (groups == 0) || (columns % groups != 0) ||
+        (columns + globals > EC_METHOD_MAX_FRAGMENTS))
+    {
+        return -1;
+    }
+
+    lrc->columns = columns;
+    lrc->groups = groups;
+    lrc->globals = globals;
+
+    return 0;
+}
+
+uint32_t ec_lrc_fragments(ec_lrc_t * lrc)
+{
+    return lrc->columns + lrc->globals + lrc->groups;
+}
+
+uint32_t ec_lrc_group(ec_lrc_t * lrc, uint32_t index)
+{
+    if (index < lrc->columns)
+    {
+        return index / (lrc->columns / lrc->groups);
+    }
+    if (index < lrc->columns + lrc->globals)
+    {
+        return lrc->groups;
+    }
+
+    return index - lrc->columns - lrc->globals;
+}
+
+/* out = in[0] ^ ... ^ in[count - 1] for chunk j of each. */
+static void ec_lrc_xor_chunk(uint8_t * out, uint8_t ** in, uint32_t count,
+                             size_t j)
+{
+    size_t off = j * EC_METHOD_CHUNK_SIZE;
+    uint32_t i;
+
+    memcpy(out + off, in[0] + off, EC_METHOD_CHUNK_SIZE);
+    for (i = 1; i < count; i++)
+    {
+        ec_gf_muladd[1](out + off, in[i] + off, EC_METHOD_WIDTH);
+    }
+}
+
+struct ec_lrc_encode_param
+{
+    ec_lrc_t * lrc;
+    size_t size;
+    uint8_t * in;
+    uint8_t ** out;
+};
+typedef struct ec_lrc_encode_param ec_lrc_encode_param_t;
+
+static void ec_lrc_encode_task(void * param, uint32_t worker, size_t index)
+{
+    ec_lrc_encode_param_t * ec_param = (ec_lrc_encode_param_t *)param;
+    ec_lrc_t * lrc = ec_param->lrc;
+    uint32_t rows = lrc->columns + lrc->globals;
+    uint32_t width = lrc->columns / lrc->groups;
+    uint8_t * out[EC_LRC_MAX_FRAGMENTS];
+    size_t first = index * EC_LRC_ENCODE_GRAIN;
+    size_t count = ec_param->size - first;
+    size_t j;
+    uint32_t g, row;
+
+    if (count > EC_LRC_ENCODE_GRAIN)
+    {
+        count = EC_LRC_ENCODE_GRAIN;
+    }
+    for (row = 0; row < rows; row++)
+    {
+        out[row] = ec_param->out[row] + first * EC_METHOD_CHUNK_SIZE;
+    }
+    ec_method_batch_encode(count * EC_METHOD_CHUNK_SIZE * lrc->columns,
+                           lrc->columns, rows,
+                           ec_param->in + first * EC_METHOD_CHUNK_SIZE *
+                                          lrc->columns,
+                           out);
+
+    for (g = 0; g < lrc->groups; g++)
+    {
+        for (j = first; j < first + count; j++)
+        {
+            ec_lrc_xor_chunk(ec_param->out[rows + g],
+                             ec_param->out + g * width, width, j);
+        }
+    }
+}
+
+size_t ec_lrc_encode(ec_lrc_t * lrc, size_t size, uint8_t * in,
+                     uint8_t ** out, int processor_count)
+{
+    ec_lrc_encode_param_t param;
+
+    size /= EC_METHOD_CHUNK_SIZE * lrc->columns;
+
+    param = (ec_lrc_encode_param_t){
+        .lrc = lrc,
+        .size = size,
+        .in = in,
+        .out = out
+    };
+    ec_sched_run((size + EC_LRC_ENCODE_GRAIN - 1) / EC_LRC_ENCODE_GRAIN,
+                 processor_count, ec_lrc_encode_task, &param);
+
+    return size * EC_METHOD_CHUNK_SIZE;
+}
+
+uint32_t ec_lrc_sources(ec_lrc_t * lrc, uint32_t index, uint32_t * sources)
+{
+    uint32_t width = lrc->columns / lrc->groups;
+    uint32_t g = ec_lrc_group(lrc, index);
+    uint32_t i, count = 0;
+
+    if (g == lrc->groups)
+    {
+        for (i = 0; i < lrc->columns; i++)
+        {
+            sources[i] = i;
+        }
+        return lrc->columns;
+    }
+
+    for (i = g * width; i < (g + 1) * width; i++)
+    {
+        if (i != index)
+        {
+            sources[count++] = i;
+        }
+    }
+    if (index < lrc->columns)
+    {
+        sources[count++] = lrc->columns + lrc->globals + g;
+    }
+
+    return count;
+}
+
+struct ec_lrc_repair_param
+{
+    size_t size;
+    uint32_t count;
+    uint8_t ** in;
+    uint8_t * out;
+};
+typedef struct ec_lrc_repair_param ec_lrc_repair_param_t;
+
+static void ec_lrc_repair_task(void * param, uint32_t worker, size_t index)
+{
+    ec_lrc_repair_param_t * ec_param = (ec_lrc_repair_param_t *)param;
+    size_t first = index * EC_LRC_REPAIR_GRAIN;
+    size_t last = first + EC_LRC_REPAIR_GRAIN;
+    size_t j;
+
+    if (last > ec_param->size)
+    {
+        last = ec_param->size;
+    }
+    for (j = first; j < last; j++)
+    {
+        ec_lrc_xor_chunk(ec_param->out, ec_param->in, ec_param->count, j);
+    }
+}
+
+size_t ec_lrc_repair(ec_lrc_t * lrc, size_t size, uint32_t index,
+                     uint8_t ** in, uint8_t * out, int processor_count)
+{
+    uint32_t sources[EC_METHOD_MAX_FRAGMENTS];
+    ec_lrc_repair_param_t param;
+    uint32_t count;
+
+    count = ec_lrc_sources(lrc, index, sources);
+    if (ec_lrc_group(lrc, index) == lrc->groups)
+    {
+        return ec_method_parallel_repair(size, lrc->columns, sources, in, 1,
+                                         &index, &out, processor_count);
+    }
+
+    size /= EC_METHOD_CHUNK_SIZE;
+
+    param = (ec_lrc_repair_param_t){
+        .size = size,
+        .count = count,
+        .in = in,
+        .out = out
+    };
+    ec_sched_run((size + EC_LRC_REPAIR_GRAIN - 1) / EC_LRC_REPAIR_GRAIN,
+                 processor_count, ec_lrc_repair_task, &param);
+
+    return size * EC_METHOD_CHUNK_SIZE;
+}
+
+size_t ec_lrc_decode(ec_lrc_t * lrc, size_t size, uint32_t count,
+                     uint32_t * indices, uint8_t ** in, uint8_t * out,
+                     int processor_count)
+{
+    uint8_t * frags[EC_LRC_MAX_FRAGMENTS];
+    uint8_t * src[EC_METHOD_MAX_FRAGMENTS];
+    uint8_t * rebuilt[EC_METHOD_MAX_FRAGMENTS];
+    uint32_t rows[EC_METHOD_MAX_FRAGMENTS];
+    uint32_t sources[EC_METHOD_MAX_FRAGMENTS];
+    uint32_t width = lrc->columns / lrc->groups;
+    uint32_t total = ec_lrc_fragments(lrc);
+    uint32_t i, g, lost, missing = 0, n = 0, rebuilds = 0;
+    size_t res = 0;
+
+    memset(frags, 0, sizeof(frags));
+    for (i = 0; i < count; i++)
+    {
+        if (indices[i] < total)
+        {
+            frags[indices[i]] = in[i];
+        }
+    }
+
+    for (g = 0; g < lrc->groups; g++)
+    {
+        lost = 0;
+        for (i = g * width; i < (g + 1) * width; i++)
+        {
+            if (frags[i] == NULL)
+            {
+                lost++;
+                missing = i;
+            }
+        }
+        if ((lost == 1) && (frags[lrc->columns + lrc->globals + g] != NULL))
+        {
+            rebuilt[rebuilds] = malloc(size);
+            if (rebuilt[rebuilds] == NULL)
+            {
+                goto out;
+            }
+            ec_lrc_sources(lrc, missing, sources);
+            for (i = 0; i < width; i++)
+            {
+                src[i] = frags[sources[i]];
+            }
+            ec_lrc_repair(lrc, size, missing, src, rebuilt[rebuilds],
+                          processor_count);
+            frags[missing] = rebuilt[rebuilds++];
+        }
+    }
+
+    for (i = 0; (i < lrc->columns + lrc->globals) && (n < lrc->columns);
+         i++)
+    {
+        if (frags[i] != NULL)
+        {
+            rows[n] = i;
+            src[n++] = frags[i];
+        }
+    }
+    if (n == lrc->columns)
+    {
+        res = ec_method_parallel_decode(size, lrc->columns, rows, src, out,
+                                        processor_count);
+    }
+
+out:
+    while (rebuilds > 0)
+    {
+        free(rebuilt[--rebuilds]);
+    }
+
+    return res;
+}
@@ -0,0 +1,63 @@
+#ifndef __EC_LRC_H__
+#define __EC_LRC_H__
+
+#include <stddef.h>
+#include <inttypes.h>
+
+#include "ec-method.h"
+
+/* Locally repairable layout over the ec-method code. Rows 0 .. columns - 1
+   of the code are split in 'groups' groups of consecutive rows, and each
+   group gets a local parity, the xor of its fragments. Rows columns ..
+   columns + globals - 1 are global parities, which cover any group.
+
+   Fragments are numbered as follows: index i < columns + globals is the
+   fragment of code row i, and index columns + globals + g is the local
+   parity of group g. A single lost fragment of a group, local parity
+   included, is rebuilt from the other columns / groups fragments of its
+   group instead of columns fragments. */
+#define EC_LRC_MAX_FRAGMENTS (3 * EC_METHOD_MAX_FRAGMENTS)
+
+struct ec_lrc
+{
+    uint32_t columns;
+    uint32_t groups;
+    uint32_t globals;
+};
+typedef struct ec_lrc ec_lrc_t;
+
+/* columns must be a multiple of groups, and columns + globals at most
+   EC_METHOD_MAX_FRAGMENTS. Returns -1 if the layout is not valid. */
+int ec_lrc_init(ec_lrc_t * lrc, uint32_t columns, uint32_t groups,
+                uint32_t globals);
+uint32_t ec_lrc_fragments(ec_lrc_t * lrc);
+/* Group of fragment index, or lrc->groups for a global parity. */
+uint32_t ec_lrc_group(ec_lrc_t * lrc, uint32_t index);
+
+/* Encodes size bytes at in into the ec_lrc_fragments() fragments of out[].
+   The local parities are computed stripe by stripe, right after the
+   fragments they cover. Returns the size of each fragment. */
+size_t ec_lrc_encode(ec_lrc_t * lrc, size_t size, uint8_t * in,
+                     uint8_t ** out, int processor_count);
+
+/* Fills sources with the fragments needed to rebuild fragment index when
+   all the others are available, and returns their count: the rest of its
+   group for a group fragment or a local parity, columns code rows for a
+   global parity. */
+uint32_t ec_lrc_sources(ec_lrc_t * lrc, uint32_t index, uint32_t * sources);
+/* Rebuilds fragment index, of size bytes, from the fragments in[] listed
+   by ec_lrc_sources, in that order. */
+size_t ec_lrc_repair(ec_lrc_t * lrc, size_t size, uint32_t index,
+                     uint8_t ** in, uint8_t * out, int processor_count);
+
+/* Decodes the data from the count fragments in[] of indices[], each of
+   size bytes. A group with one missing fragment is completed from its
+   local parity, so the global parities are only needed when a group lost
+   more; the local parity of such a group is not used. Returns the decoded
+   size, or 0 if the fragments are not enough or memory could not be
+   allocated. */
+size_t ec_lrc_decode(ec_lrc_t * lrc, size_t size, uint32_t count,
+                     uint32_t * indices, uint8_t ** in, uint8_t * out,
+                     int processor_count);
+
+#endif /* __EC_LRC_H__ */
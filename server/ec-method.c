@@ -10,10 +10,32 @@
 #include <string.h>
 #include <inttypes.h>
 #include <pthread.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 #include "ec-gf.h"
 #include "ec-method.h"
+#include "ec-layout.h"
+#include "ec-sched.h"
+#include "ec-crc.h"
 
 
+/* Number of stripes encoded by each task of the multi object encoder. */
+#define EC_METHOD_OBJECTS_GRAIN 16
+/* Number of stripes handled by each task of the parallel encoders and
+   decoder. Many small tasks let fast workers steal from slow ones. */
+#define EC_METHOD_PARALLEL_GRAIN 64
+/* Maximum number of rows the non-temporal encoder keeps in L1 at once when
+   it uses a fused encoder (16 KiB worth of chunks). */
+#define EC_METHOD_NT_ROWS (16384 / EC_METHOD_CHUNK_SIZE)
+
+/* Default number of stripes the input is prefetched ahead of the one being
+   processed. */
+#define EC_METHOD_PREFETCH_DISTANCE 2
+#define EC_METHOD_CACHE_LINE 64
+
+static uint32_t ec_method_prefetch_distance = EC_METHOD_PREFETCH_DISTANCE;
+
 static uint32_t GfPow[EC_GF_SIZE << 1];
 static uint32_t GfLog[EC_GF_SIZE << 1];
 
@@ -33,6 +55,55 @@ void ec_method_initialize(void)
         GfPow[i + EC_GF_SIZE - 1] = GfPow[i];
         GfLog[GfPow[i] + EC_GF_SIZE - 1] = GfLog[GfPow[i]] = i;
     }
+
+    ec_crc32c_initialize();
+}
+
+void ec_method_set_prefetch(uint32_t distance)
+{
+    ec_method_prefetch_distance = distance;
+}
+
+/* Prefetches the stripe 'distance' stripes after the one at in, which is
+   stripe j of size. */
+static inline void ec_method_prefetch_stripe(uint8_t * in, size_t j,
+                                             size_t size, uint32_t columns)
+{
+    uint32_t distance = ec_method_prefetch_distance;
+    size_t i;
+
+    if ((distance == 0) || (j + distance >= size))
+    {
+        return;
+    }
+    in += (size_t)distance * EC_METHOD_CHUNK_SIZE * columns;
+    for (i = 0; i < EC_METHOD_CHUNK_SIZE * columns; i += EC_METHOD_CACHE_LINE)
+    {
+        __builtin_prefetch(in + i);
+    }
+}
+
+/* Same for decode, where the chunks of a stripe come from columns
+   different fragments. */
+static inline void ec_method_prefetch_fragments(uint8_t ** in, size_t off,
+                                                size_t f, size_t size,
+                                                uint32_t columns)
+{
+    uint32_t distance = ec_method_prefetch_distance;
+    uint32_t i, j;
+
+    if ((distance == 0) || (f + distance >= size))
+    {
+        return;
+    }
+    off += (size_t)distance * EC_METHOD_CHUNK_SIZE;
+    for (j = 0; j < columns; j++)
+    {
+        for (i = 0; i < EC_METHOD_CHUNK_SIZE; i += EC_METHOD_CACHE_LINE)
+        {
+            __builtin_prefetch(in[j] + off + i);
+        }
+    }
 }
 
 static uint32_t ec_method_mul(uint32_t a, uint32_t b)
@@ -58,6 +129,33 @@ static uint32_t ec_method_div(uint32_t a, uint32_t b)
     return EC_GF_SIZE;
 }
 
+static uint32_t ec_method_pow(uint32_t a, uint32_t n)
+{
+    if (n == 0)
+    {
+        return 1;
+    }
+    if (a)
+    {
+        return GfPow[(GfLog[a] * n) % (EC_GF_SIZE - 1)];
+    }
+
+    return 0;
+}
+
+/* Splits [0, size) stripes in ranges of EC_METHOD_PARALLEL_GRAIN for the
+   parallel encoders and decoder. */
+static size_t ec_method_range(size_t size, size_t index, size_t * first)
+{
+    *first = index * EC_METHOD_PARALLEL_GRAIN;
+    if (size - *first > EC_METHOD_PARALLEL_GRAIN)
+    {
+        return EC_METHOD_PARALLEL_GRAIN;
+    }
+
+    return size - *first;
+}
+
 struct ec_encode_param{
     size_t size;
     uint32_t columns, row;
@@ -65,240 +163,887 @@ struct ec_encode_param{
 };
 typedef struct ec_encode_param ec_encode_param_t;
 
-static void* ec_method_single_encode(void * param){
-
-    uint32_t i, j;
+static void ec_method_single_encode(void * param, uint32_t worker,
+                                    size_t index)
+{
+    uint32_t j;
     ec_encode_param_t *ec_param = (ec_encode_param_t *)param;
-    size_t size = ec_param->size;
     uint32_t columns = ec_param->columns;
     uint32_t row = ec_param->row;
-    uint8_t *in = ec_param->in;
-    uint8_t *out = ec_param->out;
+    size_t first;
+    size_t size = ec_method_range(ec_param->size, index, &first);
+    uint8_t *in = ec_param->in + first * EC_METHOD_CHUNK_SIZE * columns;
+    uint8_t *out = ec_param->out + first * EC_METHOD_CHUNK_SIZE;
 
     for (j = 0; j < size; j++)
     {
-        ec_gf_muladd[0](out, in, EC_METHOD_WIDTH);
-        in += EC_METHOD_CHUNK_SIZE;
-        for (i = 1; i < columns; i++)
-        {
-            ec_gf_muladd[row](out, in, EC_METHOD_WIDTH);
-            in += EC_METHOD_CHUNK_SIZE;
-        }
+        ec_method_prefetch_stripe(in, j, size, columns);
+        ec_gf_horner[row](out, in, columns, EC_METHOD_WIDTH);
+        in += EC_METHOD_CHUNK_SIZE * columns;
         out += EC_METHOD_CHUNK_SIZE;
     }
 }
 
 size_t ec_method_parallel_encode(size_t size, uint32_t columns, uint32_t row, uint8_t * in, uint8_t * out,int processor_count)
 {
-    uint32_t i, j;
-    uint8_t * in_ptr=in,*out_ptr=out;
-    pthread_t *threads = malloc(sizeof(pthread_t)*processor_count);
-    ec_encode_param_t *params = malloc(sizeof(ec_encode_param_t)*processor_count);
+    ec_encode_param_t param;
+
     size /= EC_METHOD_CHUNK_SIZE * columns;
     row++;
 
-    for(i=0;i<processor_count;i++){
-            params[i] = (ec_encode_param_t){
-            .size = size/processor_count + (i< (size%processor_count)),
-            .columns = columns,
-            .row = row,
-            .in = in_ptr,
-            .out = out_ptr
-        };
-        //printf("%u %x\n",param.size,param.in);
-       // printf("%x\n",in);
-        in_ptr += EC_METHOD_CHUNK_SIZE * params[i].size * columns;
-        out_ptr += EC_METHOD_CHUNK_SIZE * params[i].size;
-        pthread_create(threads+i,NULL,ec_method_single_encode,(void *)(params+i));
-    }
-
-    for(i=0;i<processor_count;i++){
-        pthread_join(threads[i],NULL);
-    }
-    free(threads);
-    free(params);
+    param = (ec_encode_param_t){
+        .size = size,
+        .columns = columns,
+        .row = row,
+        .in = in,
+        .out = out
+    };
+    ec_sched_run((size + EC_METHOD_PARALLEL_GRAIN - 1) /
+                 EC_METHOD_PARALLEL_GRAIN,
+                 processor_count, ec_method_single_encode, &param);
+
     return size * EC_METHOD_CHUNK_SIZE;
 }
+/* Copies a chunk to its final place bypassing the cache when possible. */
+static void ec_method_stream_chunk(uint8_t * out, uint8_t * in)
+{
+#ifdef __SSE2__
+    __m128i * dst = (__m128i *)out;
+    __m128i * src = (__m128i *)in;
+    uint32_t i;
+
+    if (((uintptr_t)out & 15) == 0)
+    {
+        for (i = 0; i < EC_METHOD_CHUNK_SIZE / sizeof(__m128i); i++)
+        {
+            _mm_stream_si128(dst + i, _mm_load_si128(src + i));
+        }
+        return;
+    }
+#endif
+    memcpy(out, in, EC_METHOD_CHUNK_SIZE);
+}
+
+static void ec_method_stream_fence(void)
+{
+#ifdef __SSE2__
+    _mm_sfence();
+#endif
+}
+
+/* Checksums chunk j of the fragments at out[row] + off, just written by
+   the encoder and still in cache, if crc is not NULL. */
+static inline void ec_method_crc_stripe(uint32_t ** crc, size_t j,
+                                        uint8_t ** out, size_t off,
+                                        uint32_t total_rows)
+{
+    uint32_t sum[EC_METHOD_MAX_NODES];
+    uint32_t row;
+
+    if (crc != NULL)
+    {
+        ec_crc32c_multi(sum, out, off, total_rows, EC_METHOD_CHUNK_SIZE);
+        for (row = 0; row < total_rows; row++)
+        {
+            crc[row][j] = sum[row];
+        }
+    }
+}
+
 struct ec_encode_batch_param{
     size_t size;
-    uint32_t columns, total_rows, off;
+    uint32_t columns, total_rows;
+    int nt;
+    ec_gf_encode_t code;
     uint8_t * in;
     uint8_t ** out;
+    uint32_t ** crc;
 };
 typedef struct ec_encode_batch_param ec_encode_batch_param_t;
-static void* ec_method_batch_single_encode(void * param)
+static void ec_method_batch_single_encode(void * param, uint32_t worker,
+                                          size_t index)
 {
-    uint32_t i, j,row;
+    uint32_t j,row;
     ec_encode_batch_param_t *ec_param = (ec_encode_batch_param_t *)param;
-    size_t size = ec_param->size;
     uint32_t columns = ec_param->columns;
     uint32_t total_row = ec_param->total_rows;
-    uint32_t off = ec_param->off;
-    uint8_t *in = ec_param->in,*in_ptr=NULL;
+    size_t first;
+    size_t size = ec_method_range(ec_param->size, index, &first);
+    size_t off = first * EC_METHOD_CHUNK_SIZE;
+    uint8_t *in = ec_param->in + off * columns;
     uint8_t **out = ec_param->out;
+    uint32_t **crc = ec_param->crc;
+    ec_gf_encode_t code = ec_param->code;
+    uint64_t acc[EC_METHOD_NT_ROWS * EC_METHOD_CHUNK_SIZE / sizeof(uint64_t)];
+    uint8_t *acc_ptr[EC_METHOD_NT_ROWS];
+
+    if (ec_param->nt)
+    {
+        /* The chains run in registers and their results go to chunks that
+           stay in L1; only those are copied to the fragments, with
+           non-temporal stores. */
+        for (row = 0;row < EC_METHOD_NT_ROWS;row++){
+            acc_ptr[row] = (uint8_t *)acc + row * EC_METHOD_CHUNK_SIZE;
+        }
+        if (total_row > EC_METHOD_NT_ROWS){
+            code = NULL;
+        }
+        for(j = 0;j < size; j++){
+            ec_method_prefetch_stripe(in, j, size, columns);
+            if (code != NULL){
+                code(acc_ptr, 0, in, EC_METHOD_WIDTH);
+                ec_method_crc_stripe(crc, first + j, acc_ptr, 0, total_row);
+                for (row = 0;row < total_row;row++){
+                    ec_method_stream_chunk(out[row]+off+j*EC_METHOD_CHUNK_SIZE, acc_ptr[row]);
+                }
+            }
+            else{
+                for (row = 0;row < total_row;row++){
+                    ec_gf_horner[row+1](acc_ptr[0], in, columns, EC_METHOD_WIDTH);
+                    if (crc != NULL){
+                        crc[row][first + j] = ec_crc32c(0, acc_ptr[0], EC_METHOD_CHUNK_SIZE);
+                    }
+                    ec_method_stream_chunk(out[row]+off+j*EC_METHOD_CHUNK_SIZE, acc_ptr[0]);
+                }
+            }
+            in += EC_METHOD_CHUNK_SIZE * columns;
+        }
+        ec_method_stream_fence();
+        return;
+    }
 
     for(j = 0;j < size; j++){
-        for (row = 0;row < total_row;row++){
-            in_ptr = in;
-            ec_gf_muladd[0](out[row]+off+j*EC_METHOD_CHUNK_SIZE, in_ptr, EC_METHOD_WIDTH);
-            in_ptr += EC_METHOD_CHUNK_SIZE;
-            for (i = 1; i < columns; i++)
-            {
-                ec_gf_muladd[row+1](out[row]+off+j*EC_METHOD_CHUNK_SIZE, in_ptr, EC_METHOD_WIDTH);
-                in_ptr += EC_METHOD_CHUNK_SIZE;
+        ec_method_prefetch_stripe(in, j, size, columns);
+        if (code != NULL){
+            code(out, off+j*EC_METHOD_CHUNK_SIZE, in, EC_METHOD_WIDTH);
+        }
+        else{
+            for (row = 0;row < total_row;row++){
+                ec_gf_horner[row+1](out[row]+off+j*EC_METHOD_CHUNK_SIZE, in, columns, EC_METHOD_WIDTH);
             }
         }
+        ec_method_crc_stripe(crc, first + j, out, off + j*EC_METHOD_CHUNK_SIZE, total_row);
         in += EC_METHOD_CHUNK_SIZE * columns;
     }
 }
-size_t ec_method_batch_parallel_encode(size_t size, uint32_t columns, uint32_t total_rows, uint8_t * in, uint8_t ** out,int processor_count)
+static size_t ec_method_batch_parallel_run(size_t size, uint32_t columns,
+                                           uint32_t total_rows, uint8_t * in,
+                                           uint8_t ** out, uint32_t ** crc,
+                                           int processor_count, int nt)
 {
-    uint32_t i, j,off;
-    pthread_t *threads = malloc(sizeof(pthread_t)*processor_count);
-    ec_encode_batch_param_t *params = malloc(sizeof(ec_encode_batch_param_t)*processor_count);
+    ec_encode_batch_param_t param;
+
     size /= EC_METHOD_CHUNK_SIZE * columns;
-    off=0;
-
-    for(i=0;i<processor_count;i++){
-            params[i] = (ec_encode_batch_param_t){
-            .size = size/processor_count + (i< (size%processor_count)),
-            .columns = columns,
-            .total_rows = total_rows,
-            .in = in,
-            .out = out,
-            .off = off
-        };
-        in += EC_METHOD_CHUNK_SIZE * params[i].size * columns;
-        off += EC_METHOD_CHUNK_SIZE * params[i].size;
-        pthread_create(threads+i,NULL,ec_method_batch_single_encode,(void *)(params+i));
-    }
-    for(i=0;i<processor_count;i++){
-        pthread_join(threads[i],NULL);
-    }
-    free(threads);
-    free(params);
+
+    param = (ec_encode_batch_param_t){
+        .size = size,
+        .columns = columns,
+        .total_rows = total_rows,
+        .nt = nt,
+        .code = ec_gf_code(columns, total_rows),
+        .in = in,
+        .out = out,
+        .crc = crc
+    };
+    ec_sched_run((size + EC_METHOD_PARALLEL_GRAIN - 1) /
+                 EC_METHOD_PARALLEL_GRAIN,
+                 processor_count, ec_method_batch_single_encode, &param);
+
     return size * EC_METHOD_CHUNK_SIZE;
 }
+size_t ec_method_batch_parallel_encode(size_t size, uint32_t columns, uint32_t total_rows, uint8_t * in, uint8_t ** out,int processor_count)
+{
+    return ec_method_batch_parallel_run(size, columns, total_rows, in, out,
+                                        NULL, processor_count, 0);
+}
+size_t ec_method_batch_parallel_encode_crc(size_t size, uint32_t columns,
+                                           uint32_t total_rows, uint8_t * in,
+                                           uint8_t ** out, uint32_t ** crc,
+                                           int processor_count)
+{
+    return ec_method_batch_parallel_run(size, columns, total_rows, in, out,
+                                        crc, processor_count, 0);
+}
+size_t ec_method_batch_parallel_encode_nt(size_t size, uint32_t columns,
+                                          uint32_t total_rows, uint8_t * in,
+                                          uint8_t ** out, int processor_count)
+{
+    return ec_method_batch_parallel_run(size, columns, total_rows, in, out,
+                                        NULL, processor_count, 1);
+}
+size_t ec_method_batch_parallel_encode_nt_crc(size_t size, uint32_t columns,
+                                              uint32_t total_rows,
+                                              uint8_t * in, uint8_t ** out,
+                                              uint32_t ** crc,
+                                              int processor_count)
+{
+    return ec_method_batch_parallel_run(size, columns, total_rows, in, out,
+                                        crc, processor_count, 1);
+}
 size_t ec_method_batch_encode(size_t size, uint32_t columns, uint32_t total_row,
                         uint8_t * in, uint8_t ** out)
 {
-    uint32_t i, j,row;
-    uint8_t * in_ptr = in;
+    return ec_method_batch_encode_crc(size, columns, total_row, in, out, NULL);
+}
+size_t ec_method_batch_encode_crc(size_t size, uint32_t columns,
+                                  uint32_t total_row, uint8_t * in,
+                                  uint8_t ** out, uint32_t ** crc)
+{
+    uint32_t j,row;
+    ec_gf_encode_t code = ec_gf_code(columns, total_row);
     size /= EC_METHOD_CHUNK_SIZE * columns;
 
     for(j = 0;j < size; j++){
-
-        for (row = 0;row < total_row;row++){
-            in_ptr = in;
-            ec_gf_muladd[0](out[row]+j*EC_METHOD_CHUNK_SIZE, in_ptr, EC_METHOD_WIDTH);
-            in_ptr += EC_METHOD_CHUNK_SIZE;
-            for (i = 1; i < columns; i++)
-            {
-                ec_gf_muladd[row+1](out[row]+j*EC_METHOD_CHUNK_SIZE, in_ptr, EC_METHOD_WIDTH);
-                in_ptr += EC_METHOD_CHUNK_SIZE;
+        ec_method_prefetch_stripe(in, j, size, columns);
+        if (code != NULL){
+            code(out, j*EC_METHOD_CHUNK_SIZE, in, EC_METHOD_WIDTH);
+        }
+        else{
+            for (row = 0;row < total_row;row++){
+                ec_gf_horner[row+1](out[row]+j*EC_METHOD_CHUNK_SIZE, in, columns, EC_METHOD_WIDTH);
             }
         }
-        in = in_ptr;
+        ec_method_crc_stripe(crc, j, out, j*EC_METHOD_CHUNK_SIZE, total_row);
+        in += EC_METHOD_CHUNK_SIZE * columns;
+    }
+
+    return size * EC_METHOD_CHUNK_SIZE;
+}
+struct ec_objects_param{
+    uint32_t count;
+    uint32_t columns, total_rows;
+    ec_method_object_t * objects;
+    size_t * first;
+};
+typedef struct ec_objects_param ec_objects_param_t;
+
+static void ec_method_objects_task(void * data, uint32_t worker, size_t index)
+{
+    ec_objects_param_t * ec_param = (ec_objects_param_t *)data;
+    ec_method_object_t * object;
+    uint8_t * out[EC_METHOD_MAX_NODES];
+    uint32_t lo, hi, mid, row;
+    size_t stripe, stripes, size;
+
+    /* Find the object the task belongs to. */
+    lo = 0;
+    hi = ec_param->count;
+    while (hi - lo > 1)
+    {
+        mid = (lo + hi) / 2;
+        if (ec_param->first[mid] <= index)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    object = &ec_param->objects[lo];
+
+    stripe = (index - ec_param->first[lo]) * EC_METHOD_OBJECTS_GRAIN;
+    stripes = object->size / (EC_METHOD_CHUNK_SIZE * ec_param->columns) -
+              stripe;
+    if (stripes > EC_METHOD_OBJECTS_GRAIN)
+    {
+        stripes = EC_METHOD_OBJECTS_GRAIN;
+    }
+    size = stripes * EC_METHOD_CHUNK_SIZE * ec_param->columns;
+
+    for (row = 0; row < ec_param->total_rows; row++)
+    {
+        out[row] = object->out[row] + stripe * EC_METHOD_CHUNK_SIZE;
+    }
+    ec_method_batch_encode(size, ec_param->columns, ec_param->total_rows,
+                           object->in + stripe * EC_METHOD_CHUNK_SIZE *
+                                        ec_param->columns,
+                           out);
+}
 
+size_t ec_method_objects_encode(uint32_t count, ec_method_object_t * objects,
+                                uint32_t columns, uint32_t total_rows,
+                                int processor_count)
+{
+    ec_objects_param_t param;
+    size_t stripes, tasks, total;
+    uint32_t i;
+
+    param = (ec_objects_param_t){
+        .count = count,
+        .columns = columns,
+        .total_rows = total_rows,
+        .objects = objects,
+        .first = malloc(sizeof(size_t) * (count + 1))
+    };
+
+    tasks = 0;
+    total = 0;
+    for (i = 0; i < count; i++)
+    {
+        stripes = objects[i].size / (EC_METHOD_CHUNK_SIZE * columns);
+        param.first[i] = tasks;
+        tasks += (stripes + EC_METHOD_OBJECTS_GRAIN - 1) /
+                 EC_METHOD_OBJECTS_GRAIN;
+        total += stripes * EC_METHOD_CHUNK_SIZE;
+    }
+    param.first[count] = tasks;
+
+    ec_sched_run(tasks, processor_count, ec_method_objects_task, &param);
+
+    free(param.first);
+
+    return total;
+}
+
+size_t ec_method_delta_encode(size_t size, uint32_t columns, uint32_t column,
+                              uint32_t total_rows, uint8_t * old_in,
+                              uint8_t * new_in, uint8_t ** delta)
+{
+    uint32_t j, row;
+    uint32_t coef[EC_METHOD_MAX_NODES];
+    uint8_t diff[EC_METHOD_CHUNK_SIZE];
+    uint8_t dummy[EC_METHOD_CHUNK_SIZE];
+    uint8_t * out;
+
+    size /= EC_METHOD_CHUNK_SIZE;
+
+    memset(dummy, 0, sizeof(dummy));
+    for (row = 0; row < total_rows; row++)
+    {
+        coef[row] = ec_method_pow(row + 1, columns - 1 - column);
+    }
+
+    for (j = 0; j < size; j++)
+    {
+        ec_gf_muladd[0](diff, old_in, EC_METHOD_WIDTH);
+        ec_gf_muladd[1](diff, new_in, EC_METHOD_WIDTH);
+        for (row = 0; row < total_rows; row++)
+        {
+            out = delta[row] + j * EC_METHOD_CHUNK_SIZE;
+            ec_gf_muladd[0](out, diff, EC_METHOD_WIDTH);
+            ec_gf_muladd[coef[row]](out, dummy, EC_METHOD_WIDTH);
+        }
+        old_in += EC_METHOD_CHUNK_SIZE;
+        new_in += EC_METHOD_CHUNK_SIZE;
     }
 
     return size * EC_METHOD_CHUNK_SIZE;
 }
+
+size_t ec_method_delta_apply(size_t size, uint8_t * delta, uint8_t * out)
+{
+    uint32_t j;
+
+    size /= EC_METHOD_CHUNK_SIZE;
+    for (j = 0; j < size; j++)
+    {
+        ec_gf_muladd[1](out, delta, EC_METHOD_WIDTH);
+        delta += EC_METHOD_CHUNK_SIZE;
+        out += EC_METHOD_CHUNK_SIZE;
+    }
+
+    return size * EC_METHOD_CHUNK_SIZE;
+}
+
 size_t ec_method_encode(size_t size, uint32_t columns, uint32_t row,
                         uint8_t * in, uint8_t * out)
 {
-    uint32_t i, j;
+    uint32_t j;
 
     size /= EC_METHOD_CHUNK_SIZE * columns;
     row++;
     for (j = 0; j < size; j++)
     {
-        ec_gf_muladd[0](out, in, EC_METHOD_WIDTH);
-        in += EC_METHOD_CHUNK_SIZE;
-        for (i = 1; i < columns; i++)
+        ec_method_prefetch_stripe(in, j, size, columns);
+        ec_gf_horner[row](out, in, columns, EC_METHOD_WIDTH);
+        in += EC_METHOD_CHUNK_SIZE * columns;
+        out += EC_METHOD_CHUNK_SIZE;
+    }
+
+    return size * EC_METHOD_CHUNK_SIZE;
+}
+
+/* The inverter works on vectors of one byte per fragment. They are kept as
+   wide as an SSE2 register, which GCC maps to native instructions on every
+   x86-64 CPU; wider generic vectors are split badly. */
+typedef uint8_t ec_method_v_t __attribute__((vector_size(16)));
+typedef int8_t ec_method_sv_t __attribute__((vector_size(16)));
+
+#define EC_METHOD_V_LANES sizeof(ec_method_v_t)
+#define EC_METHOD_V_COUNT (EC_METHOD_MAX_FRAGMENTS / EC_METHOD_V_LANES)
+
+/* Stores in xp[b] the lane wise products x * 2^b, x being xp[0]. */
+static inline void ec_method_vpowers(ec_method_v_t * xp)
+{
+    uint32_t b;
+
+    for (b = 1; b < EC_GF_BITS; b++)
+    {
+        xp[b] = (xp[b - 1] + xp[b - 1]) ^
+                ((ec_method_v_t)((ec_method_sv_t)xp[b - 1] < 0) &
+                 (EC_GF_MOD & 0xFF));
+    }
+}
+
+/* Returns v * x lane wise, with xp from ec_method_vpowers(x): the top bit
+ * of each lane of v selects the matching power of x, and v + v brings up
+ * the next bit. Unlike a split table lookup, the multiplier can differ
+ * from lane to lane. */
+static inline ec_method_v_t ec_method_vmul(ec_method_v_t v,
+                                           ec_method_v_t * xp)
+{
+    ec_method_v_t p = { 0 };
+    int32_t b;
+
+    for (b = EC_GF_BITS - 1; b >= 0; b--)
+    {
+        p ^= xp[b] & (ec_method_v_t)((ec_method_sv_t)v < 0);
+        v += v;
+    }
+
+    return p;
+}
+
+/* Fragment r holds the values at r + 1 of the polynomial whose
+ * coefficients, highest degree first, are the data chunks. Row i of the
+ * inverse is therefore the coefficient of degree columns - 1 - i of the
+ * Lagrange basis polynomials of the points rows[j] + 1:
+ *
+ *     L_j(x) = Q_j(x) / Q_j(x_j),  Q_j(x) = M(x) / (x - x_j)
+ *
+ * where M is the product of all (x - x_m). Each Q_j is a synthetic division
+ * of M, so the whole inverse costs O(columns^2) instead of the O(columns^3)
+ * of a Gauss-Jordan elimination, which matters for short reads.
+ *
+ * Both steps are vectorized: M with one lane per degree, and the synthetic
+ * divisions of all the Q_j side by side, one lane per fragment. */
+static void ec_method_invert(uint32_t columns, uint32_t * rows,
+                             uint8_t inv[][EC_METHOD_MAX_FRAGMENTS + 1])
+{
+    ec_method_v_t xp[EC_METHOD_V_COUNT][EC_GF_BITS], sp[EC_GF_BITS];
+    ec_method_v_t q[EC_METHOD_V_COUNT], d[EC_METHOD_V_COUNT], a, t;
+    ec_method_v_t qs[EC_METHOD_MAX_FRAGMENTS][EC_METHOD_V_COUNT];
+    /* m[i + 1] holds the coefficient of degree i of M, which is monic, so
+       the one of degree columns is implicit. m[0] stays 0 so that loading
+       from m gives M shifted up by one degree. */
+    uint8_t m[EC_METHOD_MAX_FRAGMENTS + 1];
+    uint8_t row[EC_METHOD_MAX_FRAGMENTS];
+    uint32_t count = (columns + EC_METHOD_V_LANES - 1) / EC_METHOD_V_LANES;
+    uint32_t i, j, v;
+
+    memset(xp, 0, sizeof(xp));
+    for (j = 0; j < columns; j++)
+    {
+        xp[j / EC_METHOD_V_LANES][0][j % EC_METHOD_V_LANES] = rows[j] + 1;
+    }
+
+    /* M = M * (x - x_j): lane i gets m[i - 1] + x_j * m[i]. Blocks are
+       updated from the top so that the shifted loads see the old M. */
+    memset(m, 0, sizeof(m));
+    m[1] = 1;
+    for (j = 0; j < columns; j++)
+    {
+        memset(&sp[0], rows[j] + 1, sizeof(sp[0]));
+        ec_method_vpowers(sp);
+        for (v = count; v > 0; v--)
+        {
+            memcpy(&a, m + 1 + (v - 1) * EC_METHOD_V_LANES, sizeof(a));
+            memcpy(&t, m + (v - 1) * EC_METHOD_V_LANES, sizeof(t));
+            t ^= ec_method_vmul(a, sp);
+            memcpy(m + 1 + (v - 1) * EC_METHOD_V_LANES, &t, sizeof(t));
+        }
+    }
+
+    /* q[i - 1] = m[i] + x_j * q[i] and d = Q_j(x_j) by Horner. */
+    for (v = 0; v < count; v++)
+    {
+        ec_method_vpowers(xp[v]);
+        memset(&q[v], 1, sizeof(q[v]));
+        d[v] = q[v];
+        qs[columns - 1][v] = q[v];
+    }
+    for (i = columns - 1; i > 0; i--)
+    {
+        for (v = 0; v < count; v++)
+        {
+            q[v] = ec_method_vmul(q[v], xp[v]) ^ m[i + 1];
+            qs[i - 1][v] = q[v];
+            d[v] = ec_method_vmul(d[v], xp[v]) ^ q[v];
+        }
+    }
+
+    memset(xp, 0, sizeof(xp));
+    for (j = 0; j < columns; j++)
+    {
+        xp[j / EC_METHOD_V_LANES][0][j % EC_METHOD_V_LANES] =
+            ec_method_div(1, d[j / EC_METHOD_V_LANES][j % EC_METHOD_V_LANES]);
+    }
+    for (v = 0; v < count; v++)
+    {
+        ec_method_vpowers(xp[v]);
+    }
+
+    memset(inv, 0, sizeof(inv[0]) * EC_METHOD_MAX_FRAGMENTS);
+    for (i = 0; i < columns; i++)
+    {
+        for (v = 0; v < count; v++)
+        {
+            t = ec_method_vmul(qs[columns - 1 - i][v], xp[v]);
+            memcpy(row + v * EC_METHOD_V_LANES, &t, sizeof(t));
+        }
+        memcpy(inv[i], row, columns);
+        inv[i][columns] = 1;
+    }
+}
+
+/* Inverse of a set of rows plus what decode learns from it: source[i] is
+ * the only fragment row i of the inverse reads, or columns when it reads
+ * several. Such trivial rows are plain (maybe scaled) copies; a permutation
+ * inverse, e.g. all the rows of a k = 1 code, decodes with copies only. */
+struct ec_method_inverse
+{
+    uint32_t columns;
+    uint32_t rows[EC_METHOD_MAX_FRAGMENTS];
+    uint32_t source[EC_METHOD_MAX_FRAGMENTS];
+    uint8_t inv[EC_METHOD_MAX_FRAGMENTS][EC_METHOD_MAX_FRAGMENTS + 1];
+};
+typedef struct ec_method_inverse ec_method_inverse_t;
+
+/* Reads keep asking for the same set of rows, so each thread keeps the
+   last inverse it computed. */
+static __thread ec_method_inverse_t ec_method_last_inverse;
+
+/* Finds which of the first count rows of the matrix have a single non
+   zero coefficient. */
+static void ec_method_inverse_sources(ec_method_inverse_t * inverse,
+                                      uint32_t columns, uint32_t count)
+{
+    uint32_t i, j;
+
+    for (i = 0; i < count; i++)
+    {
+        inverse->source[i] = columns;
+        for (j = 0; j < columns; j++)
+        {
+            if (inverse->inv[i][j] != 0)
+            {
+                if (inverse->source[i] != columns)
+                {
+                    inverse->source[i] = columns;
+                    break;
+                }
+                inverse->source[i] = j;
+            }
+        }
+    }
+    inverse->columns = columns;
+}
+
+/* Computes in inverse the inverse for rows. */
+static void ec_method_inverse_build(ec_method_inverse_t * inverse,
+                                    uint32_t columns, uint32_t * rows)
+{
+    ec_method_invert(columns, rows, inverse->inv);
+    ec_method_inverse_sources(inverse, columns, columns);
+    memcpy(inverse->rows, rows, sizeof(uint32_t) * columns);
+}
+
+/* Returns the inverse for rows. It stays valid until the next call from
+   the same thread. */
+static ec_method_inverse_t * ec_method_inverse(uint32_t columns,
+                                               uint32_t * rows)
+{
+    ec_method_inverse_t * inverse = &ec_method_last_inverse;
+
+    if ((inverse->columns != columns) ||
+        (memcmp(inverse->rows, rows, sizeof(uint32_t) * columns) != 0))
+    {
+        ec_method_inverse_build(inverse, columns, rows);
+    }
+
+    return inverse;
+}
+
+/* Rebuilds data chunk i of one stripe from the chunks found at in[j] + off,
+ * using only row i of the inverse. */
+static void ec_method_decode_chunk(ec_method_inverse_t * inverse, uint32_t i,
+                                   uint8_t ** in, size_t off, uint8_t * out,
+                                   uint8_t * dummy)
+{
+    uint32_t columns = inverse->columns;
+    uint8_t * inv = inverse->inv[i];
+    uint32_t j, last, value;
+
+    j = inverse->source[i];
+    if (j < columns)
+    {
+        memcpy(out, in[j] + off, EC_METHOD_CHUNK_SIZE);
+        if (inv[j] != 1)
         {
-            ec_gf_muladd[row](out, in, EC_METHOD_WIDTH);
-            in += EC_METHOD_CHUNK_SIZE;
+            ec_gf_muladd[inv[j]](out, dummy, EC_METHOD_WIDTH);
         }
+        return;
+    }
+
+    last = 0;
+    j = 0;
+    do
+    {
+        while (inv[j] == 0)
+        {
+            j++;
+        }
+        if (j < columns)
+        {
+            value = ec_method_div(last, inv[j]);
+            last = inv[j];
+            ec_gf_muladd[value](out, in[j] + off, EC_METHOD_WIDTH);
+            j++;
+        }
+    } while (j < columns);
+    ec_gf_muladd[last](out, dummy, EC_METHOD_WIDTH);
+}
+
+/* Rebuilds the columns data chunks of one stripe from the chunks found at
+ * in[j] + off and returns the position following them in out. */
+static uint8_t * ec_method_decode_stripe(ec_method_inverse_t * inverse,
+                                         uint8_t ** in, size_t off,
+                                         uint8_t * out, uint8_t * dummy)
+{
+    uint32_t i;
+
+    for (i = 0; i < inverse->columns; i++)
+    {
+        ec_method_decode_chunk(inverse, i, in, off, out, dummy);
         out += EC_METHOD_CHUNK_SIZE;
     }
 
-    return size * EC_METHOD_CHUNK_SIZE;
+    return out;
 }
 
 size_t ec_method_decode(size_t size, uint32_t columns, uint32_t * rows,
                         uint8_t ** in, uint8_t * out)
 {
-    uint32_t i, j, k, off, last, value;
+    uint32_t off;
     uint32_t f;
-    uint8_t inv[EC_METHOD_MAX_FRAGMENTS][EC_METHOD_MAX_FRAGMENTS + 1];
-    uint8_t mtx[EC_METHOD_MAX_FRAGMENTS][EC_METHOD_MAX_FRAGMENTS];
+    ec_method_inverse_t * inverse;
     uint8_t dummy[EC_METHOD_CHUNK_SIZE];
 
     size /= EC_METHOD_CHUNK_SIZE;
 
-    memset(inv, 0, sizeof(inv));
-    memset(mtx, 0, sizeof(mtx));
     memset(dummy, 0, sizeof(dummy));
-    for (i = 0; i < columns; i++)
+    inverse = ec_method_inverse(columns, rows);
+
+    off = 0;
+    for (f = 0; f < size; f++)
     {
-        inv[i][i] = 1;
-        inv[i][columns] = 1;
+        ec_method_prefetch_fragments(in, off, f, size, columns);
+        out = ec_method_decode_stripe(inverse, in, off, out, dummy);
+        off += EC_METHOD_CHUNK_SIZE;
     }
-    for (i = 0; i < columns; i++)
+
+    return size * EC_METHOD_CHUNK_SIZE * columns;
+}
+
+/* Re-encodes the stripe at data for fragments first .. count - 1 of in and
+ * rows and compares the result with their chunks at off. Fragments that
+ * disagree are flagged in bad, if not NULL. Returns how many disagree. */
+static uint32_t ec_method_check_stripe(uint8_t * data, uint32_t columns,
+                                       uint32_t first, uint32_t count,
+                                       uint32_t * rows, uint8_t ** in,
+                                       size_t off, uint8_t * bad)
+{
+    uint64_t chunk[EC_METHOD_CHUNK_SIZE / sizeof(uint64_t)];
+    uint32_t i, mismatches;
+
+    mismatches = 0;
+    for (i = first; i < count; i++)
     {
-        mtx[i][columns - 1] = 1;
-        for (j = columns - 1; j > 0; j--)
+        ec_gf_horner[rows[i] + 1]((uint8_t *)chunk, data, columns,
+                                  EC_METHOD_WIDTH);
+        if (memcmp(chunk, in[i] + off, EC_METHOD_CHUNK_SIZE) != 0)
         {
-            mtx[i][j - 1] = ec_method_mul(mtx[i][j], rows[i] + 1);
+            if (bad != NULL)
+            {
+                bad[i] = 1;
+            }
+            mismatches++;
         }
     }
 
-    for (i = 0; i < columns; i++)
+    return mismatches;
+}
+
+/* Looks for the fragment among the first columns ones of a stripe whose
+ * replacement by fragment columns makes all the remaining ones agree. The
+ * stripe rebuilt without it is left at out. Returns its index, or columns
+ * if there is none. */
+static uint32_t ec_method_locate_stripe(uint32_t columns, uint32_t count,
+                                        uint32_t * rows, uint8_t ** in,
+                                        size_t off, uint8_t * out,
+                                        uint8_t * dummy)
+{
+    ec_method_inverse_t inverse;
+    uint32_t sub_rows[EC_METHOD_MAX_FRAGMENTS];
+    uint8_t * sub_in[EC_METHOD_MAX_FRAGMENTS];
+    uint32_t j;
+
+    for (j = 0; j < columns; j++)
     {
-        f = mtx[i][i];
-        for (j = 0; j < columns; j++)
+        memcpy(sub_rows, rows, sizeof(uint32_t) * columns);
+        memcpy(sub_in, in, sizeof(uint8_t *) * columns);
+        sub_rows[j] = rows[columns];
+        sub_in[j] = in[columns];
+
+        ec_method_inverse_build(&inverse, columns, sub_rows);
+        ec_method_decode_stripe(&inverse, sub_in, off, out, dummy);
+        if (ec_method_check_stripe(out, columns, columns + 1, count, rows, in,
+                                   off, NULL) == 0)
         {
-            mtx[i][j] = ec_method_div(mtx[i][j], f);
-            inv[i][j] = ec_method_div(inv[i][j], f);
+            return j;
         }
-        for (j = 0; j < columns; j++)
+    }
+
+    return columns;
+}
+
+size_t ec_method_decode_verify(size_t size, uint32_t columns, uint32_t count,
+                               uint32_t * rows, uint8_t ** in, uint8_t * out,
+                               uint8_t * bad)
+{
+    uint32_t off;
+    uint32_t f, j, mismatches;
+    ec_method_inverse_t * inverse;
+    uint8_t dummy[EC_METHOD_CHUNK_SIZE];
+
+    size /= EC_METHOD_CHUNK_SIZE;
+
+    memset(dummy, 0, sizeof(dummy));
+    memset(bad, 0, count);
+    inverse = ec_method_inverse(columns, rows);
+
+    off = 0;
+    for (f = 0; f < size; f++)
+    {
+        ec_method_prefetch_fragments(in, off, f, size, count);
+        ec_method_decode_stripe(inverse, in, off, out, dummy);
+        mismatches = ec_method_check_stripe(out, columns, columns, count,
+                                            rows, in, off, NULL);
+        if (mismatches == count - columns)
         {
-            if (i != j)
+            /* A corrupted source fragment spoils every re-encoded one. */
+            j = columns;
+            if (count - columns >= 2)
             {
-                f = mtx[j][i];
-                for (k = 0; k < columns; k++)
-                {
-                    mtx[j][k] ^= ec_method_mul(mtx[i][k], f);
-                    inv[j][k] ^= ec_method_mul(inv[i][k], f);
-                }
+                j = ec_method_locate_stripe(columns, count, rows, in, off,
+                                            out, dummy);
             }
+            if (j == columns)
+            {
+                return 0;
+            }
+            bad[j] = 1;
+        }
+        else if (mismatches > 0)
+        {
+            ec_method_check_stripe(out, columns, columns, count, rows, in,
+                                   off, bad);
+        }
+        out += EC_METHOD_CHUNK_SIZE * columns;
+        off += EC_METHOD_CHUNK_SIZE;
+    }
+
+    return size * EC_METHOD_CHUNK_SIZE * columns;
+}
+
+size_t ec_method_decode_range(size_t offset, size_t length,
+                              uint32_t columns, uint32_t * rows,
+                              uint8_t ** in, uint8_t * out)
+{
+    size_t chunk, last;
+    ec_method_inverse_t * inverse;
+    uint8_t dummy[EC_METHOD_CHUNK_SIZE];
+
+    offset /= EC_METHOD_CHUNK_SIZE;
+    length /= EC_METHOD_CHUNK_SIZE;
+
+    memset(dummy, 0, sizeof(dummy));
+    inverse = ec_method_inverse(columns, rows);
+
+    last = offset + length;
+    for (chunk = offset; chunk < last; chunk++)
+    {
+        ec_method_decode_chunk(inverse, chunk % columns, in,
+                               chunk / columns * EC_METHOD_CHUNK_SIZE, out,
+                               dummy);
+        out += EC_METHOD_CHUNK_SIZE;
+    }
+
+    return length * EC_METHOD_CHUNK_SIZE;
+}
+
+size_t ec_method_batch_encode_bytes(size_t size, uint32_t columns,
+                                    uint32_t total_row, uint8_t * in,
+                                    uint8_t ** out)
+{
+    uint32_t j, row;
+    uint64_t stripe[EC_METHOD_MAX_FRAGMENTS * EC_METHOD_CHUNK_SIZE /
+                    sizeof(uint64_t)];
+    uint8_t * out_ptr;
+
+    size /= EC_METHOD_CHUNK_SIZE * columns;
+
+    for (j = 0; j < size; j++)
+    {
+        ec_method_prefetch_stripe(in, j, size, columns);
+        ec_layout_from_bytes((uint8_t *)stripe, in,
+                             EC_METHOD_CHUNK_SIZE * columns);
+        in += EC_METHOD_CHUNK_SIZE * columns;
+        for (row = 0; row < total_row; row++)
+        {
+            out_ptr = out[row] + j * EC_METHOD_CHUNK_SIZE;
+            ec_gf_horner[row + 1](out_ptr, (uint8_t *)stripe, columns,
+                                  EC_METHOD_WIDTH);
+            ec_layout_to_bytes(out_ptr, out_ptr, EC_METHOD_CHUNK_SIZE);
         }
     }
+
+    return size * EC_METHOD_CHUNK_SIZE;
+}
+
+size_t ec_method_decode_bytes(size_t size, uint32_t columns, uint32_t * rows,
+                              uint8_t ** in, uint8_t * out)
+{
+    uint32_t i, off;
+    uint32_t f;
+    ec_method_inverse_t * inverse;
+    uint8_t dummy[EC_METHOD_CHUNK_SIZE];
+    uint64_t stripe[EC_METHOD_MAX_FRAGMENTS * EC_METHOD_CHUNK_SIZE /
+                    sizeof(uint64_t)];
+    uint8_t * planes[EC_METHOD_MAX_FRAGMENTS];
+
+    size /= EC_METHOD_CHUNK_SIZE;
+
+    memset(dummy, 0, sizeof(dummy));
+    inverse = ec_method_inverse(columns, rows);
+    for (i = 0; i < columns; i++)
+    {
+        planes[i] = (uint8_t *)stripe + i * EC_METHOD_CHUNK_SIZE;
+    }
+
     off = 0;
     for (f = 0; f < size; f++)
     {
+        ec_method_prefetch_fragments(in, off, f, size, columns);
         for (i = 0; i < columns; i++)
         {
-            last = 0;
-            j = 0;
-            do
-            {
-                while (inv[i][j] == 0)
-                {
-                    j++;
-                }
-                if (j < columns)
-                {
-                    value = ec_method_div(last, inv[i][j]);
-                    last = inv[i][j];
-                    ec_gf_muladd[value](out, in[j] + off, EC_METHOD_WIDTH);
-                    j++;
-                }
-            } while (j < columns);
-            ec_gf_muladd[last](out, dummy, EC_METHOD_WIDTH);
-            out += EC_METHOD_CHUNK_SIZE;
+            ec_layout_from_bytes(planes[i], in[i] + off,
+                                 EC_METHOD_CHUNK_SIZE);
         }
+        ec_method_decode_stripe(inverse, planes, 0, out, dummy);
+        ec_layout_to_bytes(out, out, EC_METHOD_CHUNK_SIZE * columns);
+        out += EC_METHOD_CHUNK_SIZE * columns;
         off += EC_METHOD_CHUNK_SIZE;
     }
 
@@ -308,47 +1053,27 @@ size_t ec_method_decode(size_t size, uint32_t columns, uint32_t * rows,
 struct ec_decode_param{
     size_t size;
     uint32_t columns;
-    uint32_t off;
     uint8_t ** in, * out;
     uint8_t *dummy;
-    uint8_t **inv;
+    ec_method_inverse_t * inverse;
 };
 typedef struct ec_decode_param ec_decode_param_t;
 
-void * ec_method_single_decode(void *param)
+static void ec_method_single_decode(void *param, uint32_t worker, size_t index)
 {
     ec_decode_param_t * ec_param = (ec_decode_param_t *)param;
-    size_t size = ec_param->size;
     uint32_t columns = ec_param->columns;
-    uint32_t off = ec_param->off;
-    uint8_t **in = ec_param->in;
-    uint8_t *out = ec_param->out;
-    uint8_t *dummy = ec_param->dummy;
-    uint8_t **inv = ec_param->inv;
-    uint32_t i,j,k,last,value,f;
+    size_t first;
+    size_t size = ec_method_range(ec_param->size, index, &first);
+    size_t off = first * EC_METHOD_CHUNK_SIZE;
+    uint8_t *out = ec_param->out + off * columns;
+    uint32_t f;
+
     for (f = 0; f < size; f++)
     {
-        for (i = 0; i < columns; i++)
-        {
-            last = 0;
-            j = 0;
-            do
-            {
-                while (inv[i][j] == 0)
-                {
-                    j++;
-                }
-                if (j < columns)
-                {
-                    value = ec_method_div(last, inv[i][j]);
-                    last = inv[i][j];
-                    ec_gf_muladd[value](out, in[j] + off, EC_METHOD_WIDTH);
-                    j++;
-                }
-            } while (j < columns);
-            ec_gf_muladd[last](out, dummy, EC_METHOD_WIDTH);
-            out += EC_METHOD_CHUNK_SIZE;
-        }
+        ec_method_prefetch_fragments(ec_param->in, off, f, size, columns);
+        out = ec_method_decode_stripe(ec_param->inverse, ec_param->in,
+                                      off, out, ec_param->dummy);
         off += EC_METHOD_CHUNK_SIZE;
     }
 }
@@ -356,102 +1081,182 @@ void * ec_method_single_decode(void *param)
 size_t ec_method_parallel_decode(size_t size, uint32_t columns, uint32_t * rows,
                         uint8_t ** in, uint8_t * out,int processor_count)
 {
-    uint32_t i, j, k, off, last, value;
-    uint32_t f;
-    uint8_t **inv;
-    uint8_t **mtx;
-    uint8_t *dummy;
+    ec_decode_param_t param;
+    ec_method_inverse_t * inverse;
+    uint8_t dummy[EC_METHOD_CHUNK_SIZE];
 
     size /= EC_METHOD_CHUNK_SIZE;
 
-    //Use some tricks to allocate 2-d array which is cache-friendly.
-    inv = (uint8_t **)malloc(sizeof(uint8_t *) *EC_METHOD_MAX_FRAGMENTS);
-    mtx = (uint8_t **)malloc(sizeof(uint8_t *) *EC_METHOD_MAX_FRAGMENTS);
-    dummy = malloc(EC_METHOD_CHUNK_SIZE * sizeof(uint8_t));
-
-    inv[0] = (uint8_t *)malloc((EC_METHOD_MAX_FRAGMENTS + 1)*EC_METHOD_MAX_FRAGMENTS * sizeof(uint8_t));
-    mtx[0] = (uint8_t *)malloc(EC_METHOD_MAX_FRAGMENTS*EC_METHOD_MAX_FRAGMENTS * sizeof(uint8_t ));
+    memset(dummy, 0, sizeof(dummy));
+    inverse = ec_method_inverse(columns, rows);
 
-    for(i=0;i<EC_METHOD_MAX_FRAGMENTS;i++)
-        inv[i] = (*inv + (EC_METHOD_MAX_FRAGMENTS+1) * i),mtx[i]=(*mtx + EC_METHOD_MAX_FRAGMENTS * i);
+    param = (ec_decode_param_t){
+        .size = size,
+        .columns = columns,
+        .dummy = dummy,
+        .inverse = inverse,
+        .in = in,
+        .out = out
+    };
+    ec_sched_run((size + EC_METHOD_PARALLEL_GRAIN - 1) /
+                 EC_METHOD_PARALLEL_GRAIN,
+                 processor_count, ec_method_single_decode, &param);
 
+    return size * EC_METHOD_CHUNK_SIZE * columns;
+}
 
-    for(i=0;i<EC_METHOD_MAX_FRAGMENTS;i++){
-        for(j=0;j<EC_METHOD_MAX_FRAGMENTS;j++)
-            inv[i][j]=mtx[i][j]=0;
-        inv[i][EC_METHOD_MAX_FRAGMENTS] = 0;
-    }
-    for(i=0;i<EC_METHOD_CHUNK_SIZE;i++)
-        dummy[i]=0;
+/* Builds in matrix one row per missing fragment that computes it straight
+ * from the fragments of rows: the encoding row of missing[m] times the
+ * inverse for rows. That product is the Lagrange basis of the points of
+ * rows evaluated at the point of missing[m],
+ *
+ *     c_j = prod_{i != j} (x - x_i) / (x_j - x_i),
+ *
+ * so it is computed directly, without the inverse. */
+static void ec_method_repair_matrix(ec_method_inverse_t * matrix,
+                                    uint32_t columns, uint32_t * rows,
+                                    uint32_t count, uint32_t * missing)
+{
+    uint32_t d[EC_METHOD_MAX_FRAGMENTS];
+    uint32_t i, j, m, x, p;
 
-    for (i = 0; i < columns; i++)
+    for (j = 0; j < columns; j++)
     {
-        inv[i][i] = 1;
-        inv[i][columns] = 1;
-    }
-    for (i = 0; i < columns; i++)
-    {
-        mtx[i][columns - 1] = 1;
-        for (j = columns - 1; j > 0; j--)
+        d[j] = 1;
+        for (i = 0; i < columns; i++)
         {
-            mtx[i][j - 1] = ec_method_mul(mtx[i][j], rows[i] + 1);
+            if (i != j)
+            {
+                d[j] = ec_method_mul(d[j], (rows[j] + 1) ^ (rows[i] + 1));
+            }
         }
     }
 
-    for (i = 0; i < columns; i++)
+    memset(matrix->inv, 0, sizeof(matrix->inv));
+    for (m = 0; m < count; m++)
     {
-        f = mtx[i][i];
+        x = missing[m] + 1;
+        p = 1;
         for (j = 0; j < columns; j++)
         {
-            mtx[i][j] = ec_method_div(mtx[i][j], f);
-            inv[i][j] = ec_method_div(inv[i][j], f);
+            p = ec_method_mul(p, x ^ (rows[j] + 1));
         }
         for (j = 0; j < columns; j++)
         {
-            if (i != j)
+            if (p == 0)
             {
-                f = mtx[j][i];
-                for (k = 0; k < columns; k++)
-                {
-                    mtx[j][k] ^= ec_method_mul(mtx[i][k], f);
-                    inv[j][k] ^= ec_method_mul(inv[i][k], f);
-                }
+                /* The fragment is one of rows. */
+                matrix->inv[m][j] = (x == rows[j] + 1);
+            }
+            else
+            {
+                matrix->inv[m][j] = ec_method_div(
+                    ec_method_div(p, x ^ (rows[j] + 1)), d[j]);
             }
         }
+        matrix->inv[m][columns] = 1;
     }
+    ec_method_inverse_sources(matrix, columns, count);
+}
 
-    pthread_t *threads = malloc(sizeof(pthread_t)*processor_count);
-    ec_decode_param_t *params = malloc(sizeof(ec_decode_param_t)*processor_count);
+struct ec_repair_param{
+    size_t size;
+    uint32_t columns, count;
+    uint8_t ** in, ** out;
+    uint8_t *dummy;
+    ec_method_inverse_t * matrix;
+};
+typedef struct ec_repair_param ec_repair_param_t;
 
-    off = 0;
-    for(i=0;i<processor_count;i++){
-            params[i] = (ec_decode_param_t){
-            .size = size/processor_count + (i< (size%processor_count)),
-            .columns = columns,
-            .off = off,
-            .dummy = dummy,
-            .inv = inv,
-            .in = in,
-            .out = out
-        };
-        //printf("%u %x\n",param.size,param.in);
-       // printf("%x\n",in);
-        off += EC_METHOD_CHUNK_SIZE * params[i].size;
-        out += EC_METHOD_CHUNK_SIZE * params[i].size * columns;
-        pthread_create(threads+i,NULL,ec_method_single_decode,(void *)(params+i));
-    }
-
-    for(i=0;i<processor_count;i++){
-        pthread_join(threads[i],NULL);
-    }
-
-    free(threads);
-    free(params);
-    free(dummy);
-    free(inv[0]);
-    free(mtx[0]);
-    free(inv);
-    free(mtx);
+static void ec_method_single_repair(void *param, uint32_t worker, size_t index)
+{
+    ec_repair_param_t * ec_param = (ec_repair_param_t *)param;
+    uint32_t columns = ec_param->columns;
+    size_t first;
+    size_t size = ec_method_range(ec_param->size, index, &first);
+    size_t off = first * EC_METHOD_CHUNK_SIZE;
+    uint32_t f, m;
 
-    return size * EC_METHOD_CHUNK_SIZE * columns;
+    for (f = 0; f < size; f++)
+    {
+        ec_method_prefetch_fragments(ec_param->in, off, f, size, columns);
+        for (m = 0; m < ec_param->count; m++)
+        {
+            ec_method_decode_chunk(ec_param->matrix, m, ec_param->in, off,
+                                   ec_param->out[m] + off, ec_param->dummy);
+        }
+        off += EC_METHOD_CHUNK_SIZE;
+    }
+}
+
+size_t ec_method_parallel_repair(size_t size, uint32_t columns,
+                                 uint32_t * rows, uint8_t ** in,
+                                 uint32_t count, uint32_t * missing,
+                                 uint8_t ** out, int processor_count)
+{
+    ec_repair_param_t param;
+    ec_method_inverse_t matrix;
+    uint8_t dummy[EC_METHOD_CHUNK_SIZE];
+
+    size /= EC_METHOD_CHUNK_SIZE;
+
+    memset(dummy, 0, sizeof(dummy));
+    ec_method_repair_matrix(&matrix, columns, rows, count, missing);
+
+    param = (ec_repair_param_t){
+        .size = size,
+        .columns = columns,
+        .count = count,
+        .dummy = dummy,
+        .matrix = &matrix,
+        .in = in,
+        .out = out
+    };
+    ec_sched_run((size + EC_METHOD_PARALLEL_GRAIN - 1) /
+                 EC_METHOD_PARALLEL_GRAIN,
+                 processor_count, ec_method_single_repair, &param);
+
+    return size * EC_METHOD_CHUNK_SIZE;
+}
+
+void ec_method_repair_coefficients(uint32_t columns, uint32_t * rows,
+                                   uint32_t count, uint32_t * missing,
+                                   uint8_t * coef)
+{
+    ec_method_inverse_t matrix;
+    uint32_t m;
+
+    ec_method_repair_matrix(&matrix, columns, rows, count, missing);
+    for (m = 0; m < count; m++)
+    {
+        memcpy(coef + m * columns, matrix.inv[m], columns);
+    }
+}
+
+size_t ec_method_partial(size_t size, uint32_t coef, uint8_t * in,
+                         uint8_t * partial)
+{
+    uint8_t dummy[EC_METHOD_CHUNK_SIZE];
+    uint32_t inv;
+    size_t j;
+
+    size /= EC_METHOD_CHUNK_SIZE;
+    if (coef == 0)
+    {
+        return size * EC_METHOD_CHUNK_SIZE;
+    }
+
+    /* partial + in * coef = (partial / coef + in) * coef, two muladd
+       passes over a chunk that stays in L1. */
+    memset(dummy, 0, sizeof(dummy));
+    inv = ec_method_div(1, coef);
+    for (j = 0; j < size; j++)
+    {
+        ec_gf_muladd[inv](partial, in, EC_METHOD_WIDTH);
+        ec_gf_muladd[coef](partial, dummy, EC_METHOD_WIDTH);
+        in += EC_METHOD_CHUNK_SIZE;
+        partial += EC_METHOD_CHUNK_SIZE;
+    }
+
+    return size * EC_METHOD_CHUNK_SIZE;
 }
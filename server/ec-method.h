@@ -17,15 +17,154 @@
 /* Determines the maximum number of usable elements in the Galois Field */
 #define EC_METHOD_MAX_NODES     (EC_GF_SIZE - 1)
 
+/* Number of bytes of each bit plane of a chunk. It sets the chunk geometry:
+   64 gives the original 512 byte chunks, 128, 256 and 512 give 1, 2 and 4
+   KiB chunks, which amortise the per call overhead of the kernels over
+   more vector words. Fragments of different geometries are not
+   compatible; EC_METHOD_FORMAT tags each one. */
+#ifndef EC_METHOD_WORD_SIZE
 #define EC_METHOD_WORD_SIZE 64
+#endif
+
+#if EC_METHOD_WORD_SIZE == 64
+#define EC_METHOD_FORMAT 1
+#elif EC_METHOD_WORD_SIZE == 128
+#define EC_METHOD_FORMAT 2
+#elif EC_METHOD_WORD_SIZE == 256
+#define EC_METHOD_FORMAT 3
+#elif EC_METHOD_WORD_SIZE == 512
+#define EC_METHOD_FORMAT 4
+#else
+#error "EC_METHOD_WORD_SIZE must be 64, 128, 256 or 512"
+#endif
 
 #define EC_METHOD_CHUNK_SIZE (EC_METHOD_WORD_SIZE * EC_GF_BITS)
 #define EC_METHOD_WIDTH (EC_METHOD_WORD_SIZE / EC_GF_WORD_SIZE)
 
 void ec_method_initialize(void);
+/* Sets how many stripes ahead the encode and decode loops prefetch their
+   input. 0 disables software prefetching. */
+void ec_method_set_prefetch(uint32_t distance);
 size_t ec_method_encode(size_t size, uint32_t columns, uint32_t row,
                         uint8_t * in, uint8_t * out);
 size_t ec_method_decode(size_t size, uint32_t columns, uint32_t * rows,
                         uint8_t ** in, uint8_t * out);
+/* Rebuilds only the length bytes of data starting at offset, both
+   multiples of EC_METHOD_CHUNK_SIZE, and stores them at out. Offsets are
+   those of the data passed to encode, so a range inside one data column of
+   a stripe costs about 1 / columns of decoding the whole stripe. in and
+   rows are as for ec_method_decode. */
+size_t ec_method_decode_range(size_t offset, size_t length, uint32_t columns,
+                              uint32_t * rows, uint8_t ** in, uint8_t * out);
+/* Decode that checks its input. in and rows hold count > columns
+   fragments. The data is rebuilt from the first columns ones, then the
+   other ones are re-encoded from it, stripe by stripe while it is in cache,
+   and compared. bad[i] is set to 1 if fragment i is found corrupted: a
+   redundant fragment that disagrees on its own, or one of the first
+   columns fragments whose replacement by the next one makes all the
+   others agree, in which case the stripe is rebuilt without it. Returns
+   the decoded size, or 0 if a stripe has a mismatch that no single
+   fragment explains; finding the culprit among the first columns
+   fragments needs count >= columns + 2. */
+size_t ec_method_decode_verify(size_t size, uint32_t columns, uint32_t count,
+                               uint32_t * rows, uint8_t ** in, uint8_t * out,
+                               uint8_t * bad);
+size_t ec_method_batch_encode(size_t size, uint32_t columns, uint32_t total_row,
+                              uint8_t * in, uint8_t ** out);
+size_t ec_method_parallel_encode(size_t size, uint32_t columns, uint32_t row,
+                                 uint8_t * in, uint8_t * out,
+                                 int processor_count);
+size_t ec_method_batch_parallel_encode(size_t size, uint32_t columns,
+                                       uint32_t total_rows, uint8_t * in,
+                                       uint8_t ** out, int processor_count);
+/* Same as ec_method_batch_parallel_encode, but fragments are written with
+   non-temporal stores. Meant for fragments that are not read again by the
+   CPU (e.g. sent by the NIC), so they do not evict the input from cache. */
+size_t ec_method_batch_parallel_encode_nt(size_t size, uint32_t columns,
+                                          uint32_t total_rows, uint8_t * in,
+                                          uint8_t ** out, int processor_count);
+size_t ec_method_parallel_decode(size_t size, uint32_t columns,
+                                 uint32_t * rows, uint8_t ** in,
+                                 uint8_t * out, int processor_count);
+/* Rebuilds the fragments of rows missing[0 .. count - 1], count being at
+   most EC_METHOD_MAX_FRAGMENTS, from the columns fragments in[] of rows[],
+   of size bytes each, into out[]. The encoding row of each missing
+   fragment is combined with the inverse for rows[] once, so every chunk
+   is computed from the survivors in a single muladd chain, without
+   decoding the data. Returns the size of each rebuilt fragment. */
+size_t ec_method_parallel_repair(size_t size, uint32_t columns,
+                                 uint32_t * rows, uint8_t ** in,
+                                 uint32_t count, uint32_t * missing,
+                                 uint8_t ** out, int processor_count);
+
+/* Partial parity repair, where the survivors are visited in turn (e.g.
+   along a chain of servers) instead of being gathered in one place.
+   coef[m * columns + j] receives the coefficient of fragment rows[j] in
+   the rebuilt fragment missing[m], which is the sum over j of those
+   products. ec_method_partial adds size bytes of fragment in times coef
+   to partial, in place. Both require ec_method_initialize. */
+void ec_method_repair_coefficients(uint32_t columns, uint32_t * rows,
+                                   uint32_t count, uint32_t * missing,
+                                   uint8_t * coef);
+size_t ec_method_partial(size_t size, uint32_t coef, uint8_t * in,
+                         uint8_t * partial);
+
+/* Same as ec_method_batch_encode and ec_method_batch_parallel_encode, but
+   crc[row][j] also receives the CRC32C (see ec-crc.h) of chunk j of
+   fragment row, computed right after the chunk is encoded, while it is
+   still in cache. crc[row] must hold one entry per chunk of the
+   fragment. */
+size_t ec_method_batch_encode_crc(size_t size, uint32_t columns,
+                                  uint32_t total_row, uint8_t * in,
+                                  uint8_t ** out, uint32_t ** crc);
+size_t ec_method_batch_parallel_encode_crc(size_t size, uint32_t columns,
+                                           uint32_t total_rows, uint8_t * in,
+                                           uint8_t ** out, uint32_t ** crc,
+                                           int processor_count);
+/* Same as ec_method_batch_parallel_encode_nt, with the checksums of
+   ec_method_batch_parallel_encode_crc. They are taken from the chunks
+   before they are streamed to the fragments. */
+size_t ec_method_batch_parallel_encode_nt_crc(size_t size, uint32_t columns,
+                                              uint32_t total_rows,
+                                              uint8_t * in, uint8_t ** out,
+                                              uint32_t ** crc,
+                                              int processor_count);
+
+/* Same as ec_method_batch_encode/ec_method_decode, but data and fragments
+   use the byte-wise layout of ec-layout.h. Conversion is done stripe by
+   stripe while the chunks are in cache. */
+size_t ec_method_batch_encode_bytes(size_t size, uint32_t columns,
+                                    uint32_t total_row, uint8_t * in,
+                                    uint8_t ** out);
+size_t ec_method_decode_bytes(size_t size, uint32_t columns, uint32_t * rows,
+                              uint8_t ** in, uint8_t * out);
+
+/* Independent object for ec_method_objects_encode: size bytes of data at
+   in, fragments written to out[0 .. total_rows - 1]. */
+struct ec_method_object
+{
+    size_t size;
+    uint8_t * in;
+    uint8_t ** out;
+};
+typedef struct ec_method_object ec_method_object_t;
+
+/* Encodes count objects of possibly different sizes in a single call. The
+   objects are cut in groups of stripes that processor_count threads share
+   through work stealing. Returns the total size of the fragments of one
+   row. */
+size_t ec_method_objects_encode(uint32_t count, ec_method_object_t * objects,
+                                uint32_t columns, uint32_t total_rows,
+                                int processor_count);
+
+/* Partial overwrite support. old_in and new_in hold size bytes of data
+   column 'column', starting at some chunk aligned offset of that column.
+   delta[row] receives the size bytes that must be xor'ed, with
+   ec_method_delta_apply, into fragment row at the same offset. Requires
+   ec_method_initialize. */
+size_t ec_method_delta_encode(size_t size, uint32_t columns, uint32_t column,
+                              uint32_t total_rows, uint8_t * old_in,
+                              uint8_t * new_in, uint8_t ** delta);
+size_t ec_method_delta_apply(size_t size, uint8_t * delta, uint8_t * out);
 
 #endif /* __EC_METHOD_H__ */
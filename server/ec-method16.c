@@ -0,0 +1,360 @@
+/*
+  Copyright (c) 2012-2014 DataLab, s.l. <http://www.datalab.es>
+  This file is part of GlusterFS.
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "ec-gf16.h"
+#include "ec-method16.h"
+#include "ec-sched.h"
+
+
+/* Number of stripes handled by each task of the parallel encoder and
+   decoder. Wide stripes are large, so a few are enough. */
+#define EC_METHOD16_PARALLEL_GRAIN 4
+
+static uint32_t GfPow[EC_GF16_SIZE << 1];
+static uint32_t GfLog[EC_GF16_SIZE << 1];
+
+void ec_method16_initialize(void)
+{
+    uint32_t i;
+
+    GfPow[0] = 1;
+    GfLog[0] = EC_GF16_SIZE;
+    for (i = 1; i < EC_GF16_SIZE; i++)
+    {
+        GfPow[i] = GfPow[i - 1] << 1;
+        if (GfPow[i] >= EC_GF16_SIZE)
+        {
+            GfPow[i] ^= EC_GF16_MOD;
+        }
+        GfPow[i + EC_GF16_SIZE - 1] = GfPow[i];
+        GfLog[GfPow[i] + EC_GF16_SIZE - 1] = GfLog[GfPow[i]] = i;
+    }
+}
+
+static uint32_t ec_method16_mul(uint32_t a, uint32_t b)
+{
+    if (a && b)
+    {
+        return GfPow[GfLog[a] + GfLog[b]];
+    }
+
+    return 0;
+}
+
+static uint32_t ec_method16_div(uint32_t a, uint32_t b)
+{
+    if (b)
+    {
+        if (a)
+        {
+            return GfPow[EC_GF16_SIZE - 1 + GfLog[a] - GfLog[b]];
+        }
+        return 0;
+    }
+    return EC_GF16_SIZE;
+}
+
+static size_t ec_method16_range(size_t size, size_t index, size_t * first)
+{
+    *first = index * EC_METHOD16_PARALLEL_GRAIN;
+    if (size - *first > EC_METHOD16_PARALLEL_GRAIN)
+    {
+        return EC_METHOD16_PARALLEL_GRAIN;
+    }
+
+    return size - *first;
+}
+
+size_t ec_method16_encode(size_t size, uint32_t columns, uint32_t row,
+                          uint8_t * in, uint8_t * out)
+{
+    uint32_t j;
+
+    size /= EC_METHOD16_CHUNK_SIZE * columns;
+    row++;
+    for (j = 0; j < size; j++)
+    {
+        ec_gf16_horner(out, in, row, columns, EC_METHOD16_WIDTH);
+        in += EC_METHOD16_CHUNK_SIZE * columns;
+        out += EC_METHOD16_CHUNK_SIZE;
+    }
+
+    return size * EC_METHOD16_CHUNK_SIZE;
+}
+
+static void ec_method16_encode_stripes(size_t first, size_t size,
+                                       uint32_t columns, uint32_t total_rows,
+                                       uint8_t * in, uint8_t ** out)
+{
+    size_t j;
+    uint32_t row;
+
+    in += first * EC_METHOD16_CHUNK_SIZE * columns;
+    for (j = first; j < first + size; j++)
+    {
+        for (row = 0; row < total_rows; row++)
+        {
+            ec_gf16_horner(out[row] + j * EC_METHOD16_CHUNK_SIZE, in,
+                           row + 1, columns, EC_METHOD16_WIDTH);
+        }
+        in += EC_METHOD16_CHUNK_SIZE * columns;
+    }
+}
+
+size_t ec_method16_batch_encode(size_t size, uint32_t columns,
+                                uint32_t total_rows, uint8_t * in,
+                                uint8_t ** out)
+{
+    size /= EC_METHOD16_CHUNK_SIZE * columns;
+    ec_method16_encode_stripes(0, size, columns, total_rows, in, out);
+
+    return size * EC_METHOD16_CHUNK_SIZE;
+}
+
+struct ec_encode16_param
+{
+    size_t size;
+    uint32_t columns, total_rows;
+    uint8_t * in;
+    uint8_t ** out;
+};
+typedef struct ec_encode16_param ec_encode16_param_t;
+
+static void ec_method16_single_encode(void * param, uint32_t worker,
+                                      size_t index)
+{
+    ec_encode16_param_t * ec_param = (ec_encode16_param_t *)param;
+    size_t first;
+    size_t size = ec_method16_range(ec_param->size, index, &first);
+
+    ec_method16_encode_stripes(first, size, ec_param->columns,
+                               ec_param->total_rows, ec_param->in,
+                               ec_param->out);
+}
+
+size_t ec_method16_batch_parallel_encode(size_t size, uint32_t columns,
+                                         uint32_t total_rows, uint8_t * in,
+                                         uint8_t ** out, int processor_count)
+{
+    ec_encode16_param_t param;
+
+    size /= EC_METHOD16_CHUNK_SIZE * columns;
+
+    param = (ec_encode16_param_t){
+        .size = size,
+        .columns = columns,
+        .total_rows = total_rows,
+        .in = in,
+        .out = out
+    };
+    ec_sched_run((size + EC_METHOD16_PARALLEL_GRAIN - 1) /
+                 EC_METHOD16_PARALLEL_GRAIN,
+                 processor_count, ec_method16_single_encode, &param);
+
+    return size * EC_METHOD16_CHUNK_SIZE;
+}
+
+/* Same as ec_method_invert, but the result is returned as the
+ * ec_gf16_matrix masks of its coefficients: row i of the inverse takes
+ * columns * EC_GF16_BITS entries starting at i * columns * EC_GF16_BITS.
+ * Returns NULL for more than EC_METHOD16_MAX_FRAGMENTS columns, whose
+ * matrix would take gigabytes, or if it cannot be allocated. */
+static uint16_t * ec_method16_invert(uint32_t columns, uint32_t * rows)
+{
+    uint32_t i, j, x, d;
+    uint32_t * m, * q;
+    uint16_t * masks;
+
+    if ((columns == 0) || (columns > EC_METHOD16_MAX_FRAGMENTS))
+    {
+        return NULL;
+    }
+
+    m = calloc(columns + 1, sizeof(uint32_t));
+    q = calloc(columns, sizeof(uint32_t));
+    masks = malloc((size_t)columns * columns * EC_GF16_BITS *
+                   sizeof(uint16_t));
+    if ((m == NULL) || (q == NULL) || (masks == NULL))
+    {
+        free(m);
+        free(q);
+        free(masks);
+        return NULL;
+    }
+
+    m[0] = 1;
+    for (j = 0; j < columns; j++)
+    {
+        x = rows[j] + 1;
+        for (i = j + 1; i > 0; i--)
+        {
+            m[i] = m[i - 1] ^ ec_method16_mul(m[i], x);
+        }
+        m[0] = ec_method16_mul(m[0], x);
+    }
+
+    for (j = 0; j < columns; j++)
+    {
+        x = rows[j] + 1;
+        q[columns - 1] = m[columns];
+        d = q[columns - 1];
+        for (i = columns - 1; i > 0; i--)
+        {
+            q[i - 1] = m[i] ^ ec_method16_mul(q[i], x);
+            d = ec_method16_mul(d, x) ^ q[i - 1];
+        }
+        for (i = 0; i < columns; i++)
+        {
+            ec_gf16_matrix(ec_method16_div(q[columns - 1 - i], d),
+                           masks + ((size_t)i * columns + j) *
+                                   EC_GF16_BITS);
+        }
+    }
+
+    free(m);
+    free(q);
+
+    return masks;
+}
+
+/* Rebuilds the columns data chunks of one stripe from the chunks found at
+ * in[j] + off and returns the position following them in out. */
+static uint8_t * ec_method16_decode_stripe(uint32_t columns, uint16_t * inv,
+                                           uint8_t ** in, size_t off,
+                                           uint8_t * out)
+{
+    uint32_t i;
+
+    for (i = 0; i < columns; i++)
+    {
+        ec_gf16_dot(out, in, off, inv + i * columns * EC_GF16_BITS, columns,
+                    EC_METHOD16_WIDTH);
+        out += EC_METHOD16_CHUNK_SIZE;
+    }
+
+    return out;
+}
+
+size_t ec_method16_decode(size_t size, uint32_t columns, uint32_t * rows,
+                          uint8_t ** in, uint8_t * out)
+{
+    size_t off;
+    size_t f;
+    uint16_t * inv;
+
+    size /= EC_METHOD16_CHUNK_SIZE;
+
+    inv = ec_method16_invert(columns, rows);
+    if (inv == NULL)
+    {
+        return 0;
+    }
+
+    off = 0;
+    for (f = 0; f < size; f++)
+    {
+        out = ec_method16_decode_stripe(columns, inv, in, off, out);
+        off += EC_METHOD16_CHUNK_SIZE;
+    }
+
+    free(inv);
+
+    return size * EC_METHOD16_CHUNK_SIZE * columns;
+}
+
+size_t ec_method16_decode_range(size_t offset, size_t length,
+                                uint32_t columns, uint32_t * rows,
+                                uint8_t ** in, uint8_t * out)
+{
+    size_t chunk, last;
+    uint16_t * inv;
+
+    offset /= EC_METHOD16_CHUNK_SIZE;
+    length /= EC_METHOD16_CHUNK_SIZE;
+
+    inv = ec_method16_invert(columns, rows);
+    if (inv == NULL)
+    {
+        return 0;
+    }
+
+    last = offset + length;
+    for (chunk = offset; chunk < last; chunk++)
+    {
+        ec_gf16_dot(out, in, chunk / columns * EC_METHOD16_CHUNK_SIZE,
+                    inv + chunk % columns * columns * EC_GF16_BITS, columns,
+                    EC_METHOD16_WIDTH);
+        out += EC_METHOD16_CHUNK_SIZE;
+    }
+
+    free(inv);
+
+    return length * EC_METHOD16_CHUNK_SIZE;
+}
+
+struct ec_decode16_param
+{
+    size_t size;
+    uint32_t columns;
+    uint8_t ** in, * out;
+    uint16_t * inv;
+};
+typedef struct ec_decode16_param ec_decode16_param_t;
+
+static void ec_method16_single_decode(void * param, uint32_t worker,
+                                      size_t index)
+{
+    ec_decode16_param_t * ec_param = (ec_decode16_param_t *)param;
+    uint32_t columns = ec_param->columns;
+    size_t first;
+    size_t size = ec_method16_range(ec_param->size, index, &first);
+    size_t off = first * EC_METHOD16_CHUNK_SIZE;
+    uint8_t * out = ec_param->out + off * columns;
+    size_t f;
+
+    for (f = 0; f < size; f++)
+    {
+        out = ec_method16_decode_stripe(columns, ec_param->inv, ec_param->in,
+                                        off, out);
+        off += EC_METHOD16_CHUNK_SIZE;
+    }
+}
+
+size_t ec_method16_parallel_decode(size_t size, uint32_t columns,
+                                   uint32_t * rows, uint8_t ** in,
+                                   uint8_t * out, int processor_count)
+{
+    ec_decode16_param_t param;
+    uint16_t * inv;
+
+    size /= EC_METHOD16_CHUNK_SIZE;
+
+    inv = ec_method16_invert(columns, rows);
+    if (inv == NULL)
+    {
+        return 0;
+    }
+
+    param = (ec_decode16_param_t){
+        .size = size,
+        .columns = columns,
+        .inv = inv,
+        .in = in,
+        .out = out
+    };
+    ec_sched_run((size + EC_METHOD16_PARALLEL_GRAIN - 1) /
+                 EC_METHOD16_PARALLEL_GRAIN,
+                 processor_count, ec_method16_single_decode, &param);
+
+    free(inv);
+
+    return size * EC_METHOD16_CHUNK_SIZE * columns;
+}
@@ -0,0 +1,46 @@
+/*
+  Copyright (c) 2012-2014 DataLab, s.l. <http://www.datalab.es>
+  This file is part of GlusterFS.
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#ifndef __EC_METHOD16_H__
+#define __EC_METHOD16_H__
+
+#include "ec-gf16.h"
+#include "ec-method.h"
+
+/* GF(2^16) variant of ec-method.h, for stripes with more fragments than
+   the EC_METHOD_MAX_NODES of GF(2^8) allows (e.g. 200 + 60). The calls
+   behave as their ec_method counterparts; chunks hold EC_GF16_BITS planes
+   of the same EC_METHOD_WORD_SIZE bytes, so they are twice as large. The
+   decode matrices are allocated on the heap; the decoders return 0 if
+   that fails or if columns is above EC_METHOD16_MAX_FRAGMENTS. */
+#define EC_METHOD16_MAX_FRAGMENTS 1024
+#define EC_METHOD16_MAX_NODES     (EC_GF16_SIZE - 1)
+
+#define EC_METHOD16_CHUNK_SIZE (EC_METHOD_WORD_SIZE * EC_GF16_BITS)
+#define EC_METHOD16_WIDTH EC_METHOD_WIDTH
+
+void ec_method16_initialize(void);
+size_t ec_method16_encode(size_t size, uint32_t columns, uint32_t row,
+                          uint8_t * in, uint8_t * out);
+size_t ec_method16_decode(size_t size, uint32_t columns, uint32_t * rows,
+                          uint8_t ** in, uint8_t * out);
+size_t ec_method16_decode_range(size_t offset, size_t length,
+                                uint32_t columns, uint32_t * rows,
+                                uint8_t ** in, uint8_t * out);
+size_t ec_method16_batch_encode(size_t size, uint32_t columns,
+                                uint32_t total_rows, uint8_t * in,
+                                uint8_t ** out);
+size_t ec_method16_batch_parallel_encode(size_t size, uint32_t columns,
+                                         uint32_t total_rows, uint8_t * in,
+                                         uint8_t ** out, int processor_count);
+size_t ec_method16_parallel_decode(size_t size, uint32_t columns,
+                                   uint32_t * rows, uint8_t ** in,
+                                   uint8_t * out, int processor_count);
+
+#endif /* __EC_METHOD16_H__ */
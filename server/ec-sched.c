@@ -0,0 +1,365 @@
+#include <stdlib.h>
+#include <inttypes.h>
+#include <pthread.h>
+
+#include "ec-sched.h"
+
+struct ec_sched_deque
+{
+    pthread_mutex_t lock;
+    size_t head, tail;
+} __attribute__((aligned(64)));
+typedef struct ec_sched_deque ec_sched_deque_t;
+
+struct ec_sched
+{
+    ec_sched_deque_t * deques;
+    uint32_t workers;
+    ec_sched_task_t task;
+    void * data;
+};
+typedef struct ec_sched ec_sched_t;
+
+struct ec_sched_worker
+{
+    ec_sched_t * sched;
+    uint32_t id;
+};
+typedef struct ec_sched_worker ec_sched_worker_t;
+
+/* Workers kept between runs, so that a run only wakes them instead of
+   creating and joining threads: callers such as the server encode every
+   segment of a request with its own run. Thread i of the pool is worker i
+   of the run being served; the deques are kept too. A single run uses the
+   pool at a time; a concurrent one, or one started by a task, creates its
+   own threads. */
+struct ec_sched_pool
+{
+    pthread_mutex_t run;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_cond_t done;
+    ec_sched_t * sched;
+    uint32_t workers;
+    uint64_t round;
+    uint32_t threads;
+    uint32_t ready;
+    uint32_t busy;
+    ec_sched_deque_t * deques;
+    uint32_t size;
+};
+typedef struct ec_sched_pool ec_sched_pool_t;
+
+static ec_sched_pool_t ec_sched_pool = {
+    .run = PTHREAD_MUTEX_INITIALIZER,
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .wake = PTHREAD_COND_INITIALIZER,
+    .done = PTHREAD_COND_INITIALIZER
+};
+
+static int ec_sched_pop(ec_sched_deque_t * deque, size_t * index)
+{
+    int found = 0;
+
+    pthread_mutex_lock(&deque->lock);
+    if (deque->head < deque->tail)
+    {
+        *index = deque->head++;
+        found = 1;
+    }
+    pthread_mutex_unlock(&deque->lock);
+
+    return found;
+}
+
+static int ec_sched_steal(ec_sched_t * sched, uint32_t id)
+{
+    ec_sched_deque_t * victim;
+    size_t head, tail;
+    uint32_t i;
+
+    for (i = 1; i < sched->workers; i++)
+    {
+        victim = &sched->deques[(id + i) % sched->workers];
+        pthread_mutex_lock(&victim->lock);
+        tail = victim->tail;
+        head = tail - (tail - victim->head) / 2;
+        if (victim->head < tail && head == tail)
+        {
+            /* Only one index left: take it. */
+            head = victim->head;
+        }
+        victim->tail = head;
+        pthread_mutex_unlock(&victim->lock);
+
+        if (head < tail)
+        {
+            pthread_mutex_lock(&sched->deques[id].lock);
+            sched->deques[id].head = head;
+            sched->deques[id].tail = tail;
+            pthread_mutex_unlock(&sched->deques[id].lock);
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void * ec_sched_worker(void * param)
+{
+    ec_sched_worker_t * worker = (ec_sched_worker_t *)param;
+    ec_sched_t * sched = worker->sched;
+    size_t index;
+
+    do
+    {
+        while (ec_sched_pop(&sched->deques[worker->id], &index))
+        {
+            sched->task(sched->data, worker->id, index);
+        }
+    } while (ec_sched_steal(sched, worker->id));
+
+    return NULL;
+}
+
+static void * ec_sched_pool_thread(void * param)
+{
+    ec_sched_pool_t * pool = &ec_sched_pool;
+    ec_sched_worker_t worker;
+    uint64_t round;
+
+    worker.id = (uintptr_t)param;
+
+    pthread_mutex_lock(&pool->lock);
+    round = pool->round;
+    pool->ready++;
+    pthread_cond_broadcast(&pool->done);
+    while (1)
+    {
+        while (pool->round == round)
+        {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        round = pool->round;
+        /* Threads the round does not use may only wake after it is
+           over: they must not look at its sched. */
+        if (worker.id >= pool->workers)
+        {
+            continue;
+        }
+        worker.sched = pool->sched;
+        pthread_mutex_unlock(&pool->lock);
+
+        ec_sched_worker(&worker);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->busy == 0)
+        {
+            pthread_cond_broadcast(&pool->done);
+        }
+    }
+
+    return NULL;
+}
+
+/* Makes room for count workers in the pool. Returns -1 if the deques can
+   not be allocated; threads that can not be created are left to the
+   others, as in ec_sched_spawn. */
+static int ec_sched_pool_grow(ec_sched_pool_t * pool, uint32_t count)
+{
+    ec_sched_deque_t * deques;
+    pthread_t thread;
+    uint32_t i;
+
+    if (pool->size < count)
+    {
+        if (posix_memalign((void **)&deques, 64,
+                           sizeof(ec_sched_deque_t) * count) != 0)
+        {
+            return -1;
+        }
+        for (i = 0; i < pool->size; i++)
+        {
+            pthread_mutex_destroy(&pool->deques[i].lock);
+        }
+        free(pool->deques);
+        for (i = 0; i < count; i++)
+        {
+            pthread_mutex_init(&deques[i].lock, NULL);
+        }
+        pool->deques = deques;
+        pool->size = count;
+    }
+
+    while (pool->threads + 1 < count)
+    {
+        if (pthread_create(&thread, NULL, ec_sched_pool_thread,
+                           (void *)(uintptr_t)(pool->threads + 1)) != 0)
+        {
+            break;
+        }
+        pthread_detach(thread);
+        pool->threads++;
+    }
+
+    /* A new thread must have seen the current round before the next one
+       is started, or it would miss it. */
+    pthread_mutex_lock(&pool->lock);
+    while (pool->ready < pool->threads)
+    {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return 0;
+}
+
+static void ec_sched_split(ec_sched_deque_t * deques, size_t count,
+                           uint32_t workers)
+{
+    size_t off = 0;
+    uint32_t i;
+
+    for (i = 0; i < workers; i++)
+    {
+        deques[i].head = off;
+        off += count / workers + (i < (count % workers));
+        deques[i].tail = off;
+    }
+}
+
+static void ec_sched_serial(size_t count, ec_sched_task_t task, void * data)
+{
+    size_t off;
+
+    for (off = 0; off < count; off++)
+    {
+        task(data, 0, off);
+    }
+}
+
+/* Runs with threads of its own, when the pool is taken. */
+static void ec_sched_spawn(size_t count, int processor_count,
+                           ec_sched_task_t task, void * data)
+{
+    ec_sched_t sched;
+    ec_sched_worker_t * workers;
+    pthread_t * threads;
+    uint32_t i, started;
+
+    sched.workers = processor_count;
+    sched.task = task;
+    sched.data = data;
+    if (posix_memalign((void **)&sched.deques, 64,
+                       sizeof(ec_sched_deque_t) * processor_count) != 0)
+    {
+        ec_sched_serial(count, task, data);
+        return;
+    }
+    workers = malloc(sizeof(ec_sched_worker_t) * processor_count);
+    threads = malloc(sizeof(pthread_t) * processor_count);
+    if ((workers == NULL) || (threads == NULL))
+    {
+        free(threads);
+        free(workers);
+        free(sched.deques);
+        ec_sched_serial(count, task, data);
+        return;
+    }
+
+    ec_sched_split(sched.deques, count, processor_count);
+    for (i = 0; i < processor_count; i++)
+    {
+        pthread_mutex_init(&sched.deques[i].lock, NULL);
+        workers[i] = (ec_sched_worker_t){
+            .sched = &sched,
+            .id = i
+        };
+    }
+    /* If a thread can not be created, the workers that did start steal
+       the indices of the ones that did not. */
+    for (started = 1; started < processor_count; started++)
+    {
+        if (pthread_create(threads + started, NULL, ec_sched_worker,
+                           workers + started) != 0)
+        {
+            break;
+        }
+    }
+    ec_sched_worker(workers);
+    for (i = 1; i < started; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (i = 0; i < processor_count; i++)
+    {
+        pthread_mutex_destroy(&sched.deques[i].lock);
+    }
+    free(threads);
+    free(workers);
+    free(sched.deques);
+}
+
+void ec_sched_run(size_t count, int processor_count, ec_sched_task_t task,
+                  void * data)
+{
+    ec_sched_pool_t * pool = &ec_sched_pool;
+    ec_sched_worker_t worker;
+    ec_sched_t sched;
+
+    if (processor_count < 1)
+    {
+        processor_count = 1;
+    }
+    if ((size_t)processor_count > count)
+    {
+        processor_count = (count > 0) ? count : 1;
+    }
+    if (processor_count == 1)
+    {
+        ec_sched_serial(count, task, data);
+        return;
+    }
+    if (pthread_mutex_trylock(&pool->run) != 0)
+    {
+        ec_sched_spawn(count, processor_count, task, data);
+        return;
+    }
+    if (ec_sched_pool_grow(pool, processor_count) != 0)
+    {
+        pthread_mutex_unlock(&pool->run);
+        ec_sched_spawn(count, processor_count, task, data);
+        return;
+    }
+
+    sched.deques = pool->deques;
+    sched.workers = processor_count;
+    sched.task = task;
+    sched.data = data;
+    ec_sched_split(sched.deques, count, processor_count);
+
+    /* Workers the pool could not start are stolen from by the others. */
+    pthread_mutex_lock(&pool->lock);
+    pool->sched = &sched;
+    pool->workers = processor_count;
+    pool->busy = (pool->threads < processor_count - 1) ? pool->threads
+                                                       : processor_count - 1;
+    pool->round++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    worker.sched = &sched;
+    worker.id = 0;
+    ec_sched_worker(&worker);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->busy > 0)
+    {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    pthread_mutex_unlock(&pool->run);
+}
@@ -0,0 +1,18 @@
+#ifndef __EC_SCHED_H__
+#define __EC_SCHED_H__
+
+#include <stddef.h>
+#include <inttypes.h>
+
+/* Runs task(data, worker, index) for every index in [0, count) using
+   processor_count workers, the calling thread being worker 0. Every worker
+   owns a deque initially holding an equal contiguous share of the indexes;
+   it takes work from the front of its own deque and, once it is empty,
+   steals the back half of another worker's deque. The worker threads are
+   kept between calls, so a call only costs a wakeup of each of them. */
+typedef void (* ec_sched_task_t)(void * data, uint32_t worker, size_t index);
+
+void ec_sched_run(size_t count, int processor_count, ec_sched_task_t task,
+                  void * data);
+
+#endif /* __EC_SCHED_H__ */
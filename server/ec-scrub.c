@@ -0,0 +1,264 @@
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ec-method.h"
+#include "ec-scrub.h"
+
+static double ec_scrub_clock(clockid_t id)
+{
+    struct timespec ts;
+
+    clock_gettime(id, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void ec_scrub_sleep(double seconds)
+{
+    struct timespec ts;
+
+    if (seconds <= 0)
+    {
+        return;
+    }
+    ts.tv_sec = (time_t)seconds;
+    ts.tv_nsec = (long)((seconds - ts.tv_sec) * 1e9);
+    while ((nanosleep(&ts, &ts) != 0) && (errno == EINTR))
+    {
+    }
+}
+
+/* Takes amount tokens from bucket, going into debt if needed, and returns
+   how long to wait until the debt is paid. */
+static double ec_scrub_bucket_take(ec_scrub_bucket_t * bucket,
+                                   uint64_t amount)
+{
+    double now;
+
+    if (bucket->rate == 0)
+    {
+        return 0;
+    }
+
+    now = ec_scrub_clock(CLOCK_MONOTONIC);
+    bucket->tokens += (now - bucket->last) * bucket->rate;
+    if (bucket->tokens > bucket->burst)
+    {
+        bucket->tokens = bucket->burst;
+    }
+    bucket->last = now;
+
+    bucket->tokens -= amount;
+    if (bucket->tokens >= 0)
+    {
+        return 0;
+    }
+
+    return -bucket->tokens / bucket->rate;
+}
+
+static void ec_scrub_close(ec_scrub_t * scrub)
+{
+    uint32_t i;
+
+    for (i = 0; i < scrub->count; i++)
+    {
+        if (scrub->maps[i] != NULL)
+        {
+            munmap(scrub->maps[i], scrub->size);
+        }
+        if (scrub->fds[i] >= 0)
+        {
+            close(scrub->fds[i]);
+        }
+    }
+    free(scrub->out);
+    scrub->out = NULL;
+}
+
+int ec_scrub_init(ec_scrub_t * scrub, uint32_t columns, uint32_t count,
+                  uint32_t * rows, char ** paths, uint32_t stripes,
+                  ec_scrub_report_t report, void * data)
+{
+    uint8_t seen[EC_METHOD_MAX_NODES];
+    struct stat st;
+    uint32_t i;
+
+    if ((columns == 0) || (columns > EC_METHOD_MAX_FRAGMENTS) ||
+        (count <= columns) || (count > EC_METHOD_MAX_NODES) || (stripes == 0))
+    {
+        return -1;
+    }
+    memset(seen, 0, sizeof(seen));
+    for (i = 0; i < count; i++)
+    {
+        if ((rows[i] >= EC_METHOD_MAX_NODES) || seen[rows[i]])
+        {
+            return -1;
+        }
+        seen[rows[i]] = 1;
+    }
+
+    memset(scrub, 0, sizeof(*scrub));
+    scrub->columns = columns;
+    scrub->count = count;
+    scrub->stripes = stripes;
+    scrub->cpu_percent = 100;
+    scrub->report = report;
+    scrub->data = data;
+    memcpy(scrub->rows, rows, sizeof(uint32_t) * count);
+    for (i = 0; i < count; i++)
+    {
+        scrub->fds[i] = -1;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        scrub->fds[i] = open(paths[i], O_RDONLY);
+        if ((scrub->fds[i] < 0) || (fstat(scrub->fds[i], &st) != 0))
+        {
+            goto failed;
+        }
+        if (i == 0)
+        {
+            scrub->size = st.st_size / EC_METHOD_CHUNK_SIZE *
+                          EC_METHOD_CHUNK_SIZE;
+        }
+        if ((size_t)st.st_size != scrub->size)
+        {
+            goto failed;
+        }
+        if (scrub->size == 0)
+        {
+            continue;
+        }
+        scrub->maps[i] = mmap(NULL, scrub->size, PROT_READ, MAP_SHARED,
+                              scrub->fds[i], 0);
+        if (scrub->maps[i] == MAP_FAILED)
+        {
+            scrub->maps[i] = NULL;
+            goto failed;
+        }
+        madvise(scrub->maps[i], scrub->size, MADV_SEQUENTIAL);
+    }
+
+    scrub->out = malloc((size_t)stripes * columns * EC_METHOD_CHUNK_SIZE);
+    if (scrub->out == NULL)
+    {
+        goto failed;
+    }
+
+    return 0;
+
+failed:
+    ec_scrub_close(scrub);
+
+    return -1;
+}
+
+void ec_scrub_set_budget(ec_scrub_t * scrub, uint64_t bytes_per_second,
+                         uint32_t cpu_percent)
+{
+    uint64_t group = (uint64_t)scrub->stripes * EC_METHOD_CHUNK_SIZE *
+                     scrub->count;
+
+    /* Up to one second of reads, and at least one group, may be done at
+       once after an idle period. */
+    scrub->io.rate = bytes_per_second;
+    scrub->io.burst = (bytes_per_second > group) ? bytes_per_second : group;
+    scrub->io.tokens = 0;
+    scrub->io.last = ec_scrub_clock(CLOCK_MONOTONIC);
+    scrub->cpu_percent = cpu_percent;
+}
+
+/* Releases the pages of the fragments that have been scrubbed, both from
+   the mapping and from the page cache. */
+static void ec_scrub_drop(ec_scrub_t * scrub)
+{
+    size_t page = sysconf(_SC_PAGESIZE);
+    size_t end = scrub->offset / page * page;
+    uint32_t i;
+
+    if (end <= scrub->dropped)
+    {
+        return;
+    }
+    for (i = 0; i < scrub->count; i++)
+    {
+        madvise(scrub->maps[i] + scrub->dropped, end - scrub->dropped,
+                MADV_DONTNEED);
+        posix_fadvise(scrub->fds[i], scrub->dropped, end - scrub->dropped,
+                      POSIX_FADV_DONTNEED);
+    }
+    scrub->dropped = end;
+}
+
+int ec_scrub_step(ec_scrub_t * scrub)
+{
+    uint8_t * in[EC_METHOD_MAX_NODES];
+    uint8_t bad[EC_METHOD_MAX_NODES];
+    size_t len;
+    double cpu;
+    uint32_t i, found;
+
+    if (scrub->offset >= scrub->size)
+    {
+        return 0;
+    }
+    len = (size_t)scrub->stripes * EC_METHOD_CHUNK_SIZE;
+    if (len > scrub->size - scrub->offset)
+    {
+        len = scrub->size - scrub->offset;
+    }
+
+    ec_scrub_sleep(ec_scrub_bucket_take(&scrub->io, len * scrub->count));
+
+    cpu = ec_scrub_clock(CLOCK_THREAD_CPUTIME_ID);
+    for (i = 0; i < scrub->count; i++)
+    {
+        in[i] = scrub->maps[i] + scrub->offset;
+    }
+    if (ec_method_decode_verify(len, scrub->columns, scrub->count,
+                                scrub->rows, in, scrub->out, bad) == 0)
+    {
+        scrub->report(scrub->data, scrub->count, scrub->offset, len);
+        scrub->mismatches++;
+    }
+    else
+    {
+        found = 0;
+        for (i = 0; i < scrub->count; i++)
+        {
+            if (bad[i])
+            {
+                scrub->report(scrub->data, i, scrub->offset, len);
+                found = 1;
+            }
+        }
+        scrub->mismatches += found;
+    }
+    scrub->offset += len;
+    ec_scrub_drop(scrub);
+    cpu = ec_scrub_clock(CLOCK_THREAD_CPUTIME_ID) - cpu;
+
+    /* Idle long enough for the time spent to be cpu_percent of the
+       total. */
+    ec_scrub_sleep(cpu * (100 - scrub->cpu_percent) / scrub->cpu_percent);
+
+    return 1;
+}
+
+uint64_t ec_scrub_finish(ec_scrub_t * scrub)
+{
+    ec_scrub_close(scrub);
+
+    return scrub->mismatches;
+}
@@ -0,0 +1,71 @@
+#ifndef __EC_SCRUB_H__
+#define __EC_SCRUB_H__
+
+#include <stddef.h>
+#include <inttypes.h>
+
+#include "ec-method.h"
+
+/* Called for every group of stripes with an inconsistency. fragment is the
+   index of the corrupted fragment, or the fragment count if the mismatch
+   could not be pinned to one; offset and size delimit the group inside
+   the fragment files. */
+typedef void (* ec_scrub_report_t)(void * data, uint32_t fragment,
+                                   size_t offset, size_t size);
+
+/* Token bucket: rate units per second, up to burst of them saved. */
+struct ec_scrub_bucket
+{
+    uint64_t rate;
+    uint64_t burst;
+    double tokens;
+    double last;
+};
+typedef struct ec_scrub_bucket ec_scrub_bucket_t;
+
+struct ec_scrub
+{
+    uint32_t columns;
+    uint32_t count;
+    uint32_t stripes;
+    uint32_t rows[EC_METHOD_MAX_NODES];
+    int fds[EC_METHOD_MAX_NODES];
+    uint8_t * maps[EC_METHOD_MAX_NODES];
+    size_t size;
+    size_t offset;
+    /* Mapped bytes already dropped from memory. */
+    size_t dropped;
+    uint8_t * out;
+    /* Bytes read per second. */
+    ec_scrub_bucket_t io;
+    /* Percentage of one CPU the scrub may use, 100 for no limit. */
+    uint32_t cpu_percent;
+    uint64_t mismatches;
+    ec_scrub_report_t report;
+    void * data;
+};
+typedef struct ec_scrub ec_scrub_t;
+
+/* Background scrubber of stored fragments. paths[i] holds fragment rows[i]
+   of the same objects, count > columns of them, all of the same size.
+   The files are mapped and walked 'stripes' stripes at a time: data is
+   rebuilt from the first columns fragments with ec_method_decode_verify,
+   which re-encodes the other ones and compares them. Pages are dropped
+   from the page cache once scrubbed, so the scrub does not evict the
+   foreground working set. Requires ec_method_initialize. Returns -1 if
+   the rows are not distinct rows below EC_METHOD_MAX_NODES, or if the
+   files can not be used. */
+int ec_scrub_init(ec_scrub_t * scrub, uint32_t columns, uint32_t count,
+                  uint32_t * rows, char ** paths, uint32_t stripes,
+                  ec_scrub_report_t report, void * data);
+/* Limits the scrub to bytes_per_second of fragment reads (0 for no limit)
+   and to cpu_percent of one CPU, which must be 1 .. 100. The limits are
+   enforced by sleeping between groups of stripes. */
+void ec_scrub_set_budget(ec_scrub_t * scrub, uint64_t bytes_per_second,
+                         uint32_t cpu_percent);
+/* Scrubs the next group of stripes. Returns 0 once the files are done. */
+int ec_scrub_step(ec_scrub_t * scrub);
+/* Unmaps the files. Returns the number of groups with a mismatch. */
+uint64_t ec_scrub_finish(ec_scrub_t * scrub);
+
+#endif /* __EC_SCRUB_H__ */
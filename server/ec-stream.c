@@ -0,0 +1,140 @@
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "ec-method.h"
+#include "ec-stream.h"
+
+int ec_stream_init(ec_stream_t * stream, uint32_t columns,
+                   uint32_t total_rows, uint32_t stripes,
+                   int processor_count, ec_stream_emit_t emit, void * data)
+{
+    uint32_t row;
+
+    memset(stream, 0, sizeof(*stream));
+    stream->columns = columns;
+    stream->total_rows = total_rows;
+    stream->stripes = stripes;
+    stream->processor_count = processor_count;
+    stream->emit = emit;
+    stream->data = data;
+
+    stream->in = malloc((size_t)stripes * columns * EC_METHOD_CHUNK_SIZE);
+    stream->out = malloc(sizeof(uint8_t *) * total_rows);
+    if (stream->in == NULL || stream->out == NULL)
+    {
+        goto failed;
+    }
+    stream->out[0] = malloc((size_t)stripes * total_rows *
+                            EC_METHOD_CHUNK_SIZE);
+    if (stream->out[0] == NULL)
+    {
+        goto failed;
+    }
+    for (row = 1; row < total_rows; row++)
+    {
+        stream->out[row] = stream->out[0] +
+                           (size_t)row * stripes * EC_METHOD_CHUNK_SIZE;
+    }
+
+    return 0;
+
+failed:
+    free(stream->in);
+    free(stream->out);
+    stream->in = NULL;
+    stream->out = NULL;
+
+    return -1;
+}
+
+static void ec_stream_encode(ec_stream_t * stream, uint8_t * in, size_t size)
+{
+    uint32_t row;
+
+    if (stream->processor_count > 1)
+    {
+        size = ec_method_batch_parallel_encode(size, stream->columns,
+                                               stream->total_rows, in,
+                                               stream->out,
+                                               stream->processor_count);
+    }
+    else
+    {
+        size = ec_method_batch_encode(size, stream->columns,
+                                      stream->total_rows, in, stream->out);
+    }
+    for (row = 0; row < stream->total_rows; row++)
+    {
+        stream->emit(stream->data, row, stream->offset, stream->out[row],
+                     size);
+    }
+    stream->offset += size;
+}
+
+void ec_stream_feed(ec_stream_t * stream, uint8_t * in, size_t size)
+{
+    size_t block = (size_t)stream->stripes * stream->columns *
+                   EC_METHOD_CHUNK_SIZE;
+    size_t len;
+
+    if (stream->in == NULL)
+    {
+        return;
+    }
+
+    while (size > 0)
+    {
+        /* Whole blocks are encoded straight from the caller's buffer. */
+        if ((stream->fill == 0) && (size >= block))
+        {
+            ec_stream_encode(stream, in, block);
+            in += block;
+            size -= block;
+            continue;
+        }
+
+        len = block - stream->fill;
+        if (len > size)
+        {
+            len = size;
+        }
+        memcpy(stream->in + stream->fill, in, len);
+        stream->fill += len;
+        in += len;
+        size -= len;
+
+        if (stream->fill == block)
+        {
+            ec_stream_encode(stream, stream->in, block);
+            stream->fill = 0;
+        }
+    }
+}
+
+size_t ec_stream_finish(ec_stream_t * stream)
+{
+    size_t stripe = (size_t)stream->columns * EC_METHOD_CHUNK_SIZE;
+    size_t len;
+
+    if (stream->out == NULL)
+    {
+        return 0;
+    }
+
+    if (stream->fill > 0)
+    {
+        len = (stream->fill + stripe - 1) / stripe * stripe;
+        memset(stream->in + stream->fill, 0, len - stream->fill);
+        ec_stream_encode(stream, stream->in, len);
+        stream->fill = 0;
+    }
+
+    free(stream->in);
+    free(stream->out[0]);
+    free(stream->out);
+    stream->in = NULL;
+    stream->out = NULL;
+
+    return stream->offset;
+}
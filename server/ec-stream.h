@@ -0,0 +1,40 @@
+#ifndef __EC_STREAM_H__
+#define __EC_STREAM_H__
+
+#include <stddef.h>
+#include <inttypes.h>
+
+/* Called every time a group of stripes has been encoded. ptr holds size
+   bytes of fragment row, to be stored at offset inside that fragment. The
+   buffer is reused once the callback returns. */
+typedef void (* ec_stream_emit_t)(void * data, uint32_t row, size_t offset,
+                                  uint8_t * ptr, size_t size);
+
+struct ec_stream
+{
+    uint32_t columns;
+    uint32_t total_rows;
+    uint32_t stripes;
+    int processor_count;
+    size_t fill;
+    size_t offset;
+    uint8_t * in;
+    uint8_t ** out;
+    ec_stream_emit_t emit;
+    void * data;
+};
+typedef struct ec_stream ec_stream_t;
+
+/* Streaming encoder. Input can be fed in pieces of any size; it is encoded
+   every 'stripes' complete stripes, so memory use is bounded by
+   stripes * (columns + total_rows) chunks whatever the object size. */
+int ec_stream_init(ec_stream_t * stream, uint32_t columns,
+                   uint32_t total_rows, uint32_t stripes,
+                   int processor_count, ec_stream_emit_t emit, void * data);
+void ec_stream_feed(ec_stream_t * stream, uint8_t * in, size_t size);
+/* Pads the last stripe with zeros, emits what is left and releases the
+   buffers. Returns the size of each fragment. After a failed
+   ec_stream_init, feeding does nothing and this returns 0. */
+size_t ec_stream_finish(ec_stream_t * stream);
+
+#endif /* __EC_STREAM_H__ */
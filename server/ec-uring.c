@@ -0,0 +1,247 @@
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+
+#include "ec-uring.h"
+
+static int ec_uring_enter(ec_uring_t * ring, unsigned submit,
+                          unsigned complete, unsigned flags)
+{
+    return syscall(__NR_io_uring_enter, ring->fd, submit, complete, flags,
+                   NULL, 0);
+}
+
+int ec_uring_init(ec_uring_t * ring, unsigned entries, void * buf,
+                  size_t size, unsigned count)
+{
+    struct io_uring_params p;
+    struct iovec * iov;
+    unsigned i;
+    int err;
+
+    memset(ring, 0, sizeof(*ring));
+    memset(&p, 0, sizeof(p));
+    ring->fd = syscall(__NR_io_uring_setup, entries, &p);
+    if (ring->fd < 0)
+    {
+        return -1;
+    }
+    ring->entries = p.sq_entries;
+
+    ring->sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    ring->cq_size = p.cq_off.cqes +
+                    p.cq_entries * sizeof(struct io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (ring->cq_size > ring->sq_size)
+        {
+            ring->sq_size = ring->cq_size;
+        }
+        ring->cq_size = 0;
+    }
+    ring->sq_ptr = mmap(NULL, ring->sq_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, ring->fd,
+                        IORING_OFF_SQ_RING);
+    if (ring->sq_ptr == MAP_FAILED)
+    {
+        goto failed;
+    }
+    ring->cq_ptr = ring->sq_ptr;
+    if (ring->cq_size != 0)
+    {
+        ring->cq_ptr = mmap(NULL, ring->cq_size, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE, ring->fd,
+                            IORING_OFF_CQ_RING);
+        if (ring->cq_ptr == MAP_FAILED)
+        {
+            goto failed;
+        }
+    }
+    ring->sqes = mmap(NULL, p.sq_entries * sizeof(struct io_uring_sqe),
+                      PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED)
+    {
+        goto failed;
+    }
+
+    ring->sq_head = (unsigned *)((char *)ring->sq_ptr + p.sq_off.head);
+    ring->sq_tail = (unsigned *)((char *)ring->sq_ptr + p.sq_off.tail);
+    ring->sq_mask = (unsigned *)((char *)ring->sq_ptr + p.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)((char *)ring->sq_ptr + p.sq_off.array);
+    ring->cq_head = (unsigned *)((char *)ring->cq_ptr + p.cq_off.head);
+    ring->cq_tail = (unsigned *)((char *)ring->cq_ptr + p.cq_off.tail);
+    ring->cq_mask = (unsigned *)((char *)ring->cq_ptr + p.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)((char *)ring->cq_ptr +
+                                         p.cq_off.cqes);
+
+    iov = malloc(sizeof(struct iovec) * count);
+    if (iov == NULL)
+    {
+        goto failed;
+    }
+    for (i = 0; i < count; i++)
+    {
+        iov[i].iov_base = (uint8_t *)buf + (size_t)i * size;
+        iov[i].iov_len = size;
+    }
+    err = syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_BUFFERS,
+                  iov, count);
+    free(iov);
+    if (err != 0)
+    {
+        goto failed;
+    }
+    ring->pending = calloc(count, sizeof(unsigned));
+    ring->failed = calloc(count, sizeof(int));
+    if ((ring->pending == NULL) || (ring->failed == NULL))
+    {
+        goto failed;
+    }
+    ring->base = buf;
+    ring->size = size;
+    ring->count = count;
+
+    return 0;
+
+failed:
+    ec_uring_exit(ring);
+
+    return -1;
+}
+
+/* Takes the next completion, waiting for one if there is none, and
+   charges it to the buffer its write came from. */
+static int ec_uring_reap(ec_uring_t * ring)
+{
+    struct io_uring_cqe * cqe;
+    unsigned head, buf;
+
+    head = *ring->cq_head;
+    while (head == __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE))
+    {
+        if ((ec_uring_enter(ring, 0, 1, IORING_ENTER_GETEVENTS) < 0) &&
+            (errno != EINTR))
+        {
+            return -1;
+        }
+    }
+    cqe = &ring->cqes[head & *ring->cq_mask];
+    buf = cqe->user_data >> 32;
+    if ((cqe->res < 0) || ((uint32_t)cqe->res != (uint32_t)cqe->user_data))
+    {
+        ring->failed[buf] = 1;
+    }
+    __atomic_store_n(ring->cq_head, head + 1, __ATOMIC_RELEASE);
+    ring->inflight--;
+    ring->pending[buf]--;
+
+    return 0;
+}
+
+int ec_uring_write(ec_uring_t * ring, int fd, void * ptr, size_t size,
+                   off_t offset)
+{
+    struct io_uring_sqe * sqe;
+    unsigned tail, index, buf;
+
+    if (ring->inflight + ring->queued == ring->entries)
+    {
+        if ((ec_uring_submit(ring) != 0) || (ec_uring_reap(ring) != 0))
+        {
+            return -1;
+        }
+    }
+
+    tail = *ring->sq_tail;
+    index = tail & *ring->sq_mask;
+    sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_WRITE_FIXED;
+    sqe->fd = fd;
+    sqe->off = offset;
+    sqe->addr = (uintptr_t)ptr;
+    sqe->len = size;
+    buf = ((uint8_t *)ptr - ring->base) / ring->size;
+    sqe->buf_index = buf;
+    /* Buffer in the high half, expected result in the low one. */
+    sqe->user_data = ((uint64_t)buf << 32) | size;
+    ring->sq_array[index] = index;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ring->queued++;
+    ring->pending[buf]++;
+
+    return 0;
+}
+
+int ec_uring_submit(ec_uring_t * ring)
+{
+    int done;
+
+    while (ring->queued > 0)
+    {
+        done = ec_uring_enter(ring, ring->queued, 0, 0);
+        if (done <= 0)
+        {
+            return -1;
+        }
+        ring->queued -= done;
+        ring->inflight += done;
+    }
+
+    return 0;
+}
+
+int ec_uring_wait(ec_uring_t * ring, unsigned buf, unsigned left)
+{
+    int failed;
+
+    if (ec_uring_submit(ring) != 0)
+    {
+        return -1;
+    }
+    while (ring->pending[buf] > left)
+    {
+        if (ec_uring_reap(ring) != 0)
+        {
+            return -1;
+        }
+    }
+
+    failed = ring->failed[buf];
+    ring->failed[buf] = 0;
+
+    return failed ? -1 : 0;
+}
+
+void ec_uring_exit(ec_uring_t * ring)
+{
+    if ((ring->sqes != NULL) && (ring->sqes != MAP_FAILED))
+    {
+        munmap(ring->sqes, ring->entries * sizeof(struct io_uring_sqe));
+    }
+    if ((ring->cq_ptr != NULL) && (ring->cq_ptr != MAP_FAILED) &&
+        (ring->cq_ptr != ring->sq_ptr))
+    {
+        munmap(ring->cq_ptr, ring->cq_size);
+    }
+    if ((ring->sq_ptr != NULL) && (ring->sq_ptr != MAP_FAILED))
+    {
+        munmap(ring->sq_ptr, ring->sq_size);
+    }
+    if (ring->fd >= 0)
+    {
+        close(ring->fd);
+    }
+    ring->fd = -1;
+    free(ring->pending);
+    free(ring->failed);
+    ring->pending = NULL;
+    ring->failed = NULL;
+}
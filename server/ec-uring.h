@@ -0,0 +1,60 @@
+#ifndef __EC_URING_H__
+#define __EC_URING_H__
+
+#include <stddef.h>
+#include <inttypes.h>
+#include <sys/types.h>
+
+/* Minimal io_uring writer for fragment persistence, built on the raw
+ * system calls. The buffers given to ec_uring_init are registered with the
+ * kernel, so writes from them are IORING_OP_WRITE_FIXED and their pages
+ * are not pinned again for every request. Writes are queued with
+ * ec_uring_write and handed to the kernel in one call by ec_uring_submit;
+ * the caller keeps encoding while they run. Completions are counted for
+ * each registered buffer, so users of different buffers (e.g. one per
+ * connection) only wait for their own writes. */
+struct ec_uring
+{
+    int fd;
+    unsigned entries;
+    unsigned queued;
+    unsigned inflight;
+    uint8_t * base;
+    size_t size;
+    unsigned count;
+    /* Writes not completed yet, and whether one failed, per buffer. */
+    unsigned * pending;
+    int * failed;
+    void * sq_ptr;
+    void * cq_ptr;
+    size_t sq_size;
+    size_t cq_size;
+    unsigned * sq_head;
+    unsigned * sq_tail;
+    unsigned * sq_mask;
+    unsigned * sq_array;
+    unsigned * cq_head;
+    unsigned * cq_tail;
+    unsigned * cq_mask;
+    struct io_uring_sqe * sqes;
+    struct io_uring_cqe * cqes;
+};
+typedef struct ec_uring ec_uring_t;
+
+/* Registers count buffers of size bytes each, one after the other from
+   buf. A single buffer can not exceed 1 GiB. */
+int ec_uring_init(ec_uring_t * ring, unsigned entries, void * buf,
+                  size_t size, unsigned count);
+/* Queues a write of size bytes at ptr, inside one registered buffer, to
+   fd at offset. Waits for an older write to complete if the ring is
+   full. */
+int ec_uring_write(ec_uring_t * ring, int fd, void * ptr, size_t size,
+                   off_t offset);
+int ec_uring_submit(ec_uring_t * ring);
+/* Submits the queued writes and waits until at most 'left' writes from
+   registered buffer buf are not completed. Returns -1 if any write from
+   buf completed since the last call for it failed or was short. */
+int ec_uring_wait(ec_uring_t * ring, unsigned buf, unsigned left);
+void ec_uring_exit(ec_uring_t * ring);
+
+#endif /* __EC_URING_H__ */
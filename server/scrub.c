@@ -0,0 +1,101 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ec-method.h"
+#include "ec-scrub.h"
+
+/* Scrubs fragment files in the background:
+ *
+ *	scrub [-r MiB/s] [-c cpu%] [-s stripes] columns row:path ...
+ *
+ * The first columns fragments are used to rebuild the data, the others are
+ * checked against it. Exits with 1 if a mismatch was found. */
+
+#define SCRUB_STRIPES 256
+
+static char **paths;
+
+static void report(void *data, uint32_t fragment, size_t offset, size_t size)
+{
+	uint32_t count = *(uint32_t *)data;
+
+	if (fragment < count)
+		printf("%s: corrupted at %zu..%zu\n", paths[fragment], offset,
+		       offset + size);
+	else
+		printf("mismatch at %zu..%zu, fragment unknown\n", offset,
+		       offset + size);
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t rows[EC_METHOD_MAX_NODES];
+	uint32_t columns, count, stripes = SCRUB_STRIPES, cpu = 100;
+	uint64_t rate = 0, mismatches;
+	ec_scrub_t *scrub;
+	char *sep;
+	uint32_t i;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "r:c:s:")) != -1) {
+		switch (opt) {
+		case 'r':
+			rate = strtoull(optarg, NULL, 0) << 20;
+			break;
+		case 'c':
+			cpu = atoi(optarg);
+			if (cpu == 0 || cpu > 100)
+				goto usage;
+			break;
+		case 's':
+			stripes = atoi(optarg);
+			break;
+		default:
+			goto usage;
+		}
+	}
+	if (argc - optind < 3)
+		goto usage;
+
+	columns = atoi(argv[optind++]);
+	count = argc - optind;
+	if (count > EC_METHOD_MAX_NODES)
+		goto usage;
+	paths = argv + optind;
+	for (i = 0; i < count; i++) {
+		sep = strchr(paths[i], ':');
+		if (sep == NULL)
+			goto usage;
+		*sep = 0;
+		rows[i] = atoi(paths[i]);
+		paths[i] = sep + 1;
+	}
+
+	ec_method_initialize();
+
+	scrub = malloc(sizeof(*scrub));
+	if (scrub == NULL)
+		return 2;
+	if (ec_scrub_init(scrub, columns, count, rows, paths, stripes, report,
+			  &count)) {
+		fprintf(stderr, "cannot scrub these fragments\n");
+		return 2;
+	}
+	ec_scrub_set_budget(scrub, rate, cpu);
+	while (ec_scrub_step(scrub))
+		;
+	mismatches = ec_scrub_finish(scrub);
+	free(scrub);
+
+	printf("%llu groups of %u stripes with mismatches\n",
+	       (unsigned long long)mismatches, stripes);
+
+	return mismatches != 0;
+
+usage:
+	fprintf(stderr, "usage: %s [-r MiB/s] [-c cpu%%] [-s stripes] "
+		"columns row:path ...\n", argv[0]);
+	return 2;
+}
@@ -1,294 +1,836 @@
+#define _GNU_SOURCE
 #include <stdlib.h>
 #include <stdio.h>
 #include <unistd.h>
 #include <sys/time.h>
+#include <sys/sysinfo.h>
 #include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <arpa/inet.h>
 
 #include <infiniband/arch.h>
 #include <rdma/rdma_cma.h>
 
-#define BUFSIZE (1<<30)
+#include "ec-method.h"
+#include "ec-uring.h"
+
 #define DATASIZE (1<<29)
 
 #define ROW 24
-#define COLUMN 16 
+#define COLUMN 16
+#define FRAGSIZE (DATASIZE / COLUMN)
+#define URING_DEPTH 256
+/* Default pipeline window (-w): work requests a connection may have in
+   flight. The send queue, the shared receive queue and the CQ are sized
+   from it, within the limits of the device. */
+#define WINDOW 64
+
+/* Requests arrive in segments of at most SLOTSIZE bytes, each received in
+   one slot of a ring shared by all the connections through the shared
+   receive queue. There is one slot per entry of that queue, so receive
+   memory follows the window, not the number of connections. Encode
+   segments are encoded as they arrive, then their slot is posted again;
+   a slot must hold whole stripes. With -d, the fragment writes of a
+   segment bypass the page cache, so len / COLUMN must also be a multiple
+   of the direct I/O alignment of the fragment files (from statx, or
+   DIO_ALIGN if the kernel does not report it); other segments are
+   refused before being encoded. Full slots always qualify. */
+#define SLOTSIZE (1 << 22)
+#define STRIPESIZE (COLUMN * EC_METHOD_CHUNK_SIZE)
+#define DIO_ALIGN 4096
+/* Checksums of an encode: one CRC32C per chunk of each fragment, the
+   FRAGCHUNKS of row 0 first. They follow the fragments in the reply. */
+#define FRAGCHUNKS (FRAGSIZE / EC_METHOD_CHUNK_SIZE)
+#define CRCSIZE (ROW * FRAGCHUNKS * sizeof(uint32_t))
+/* Connections served at once. Each one has OUTSIZE bytes for the
+   fragments of its last encode and their checksums. */
+#define OUTSIZE (FRAGSIZE * ROW + CRCSIZE)
+#define MAX_CONNS 4
+/* Completions handled per ibv_poll_cq call. */
+#define POLL_BATCH 32
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
 
 enum {
 	RESOLVE_TIMEOUT_MS	= 5000,
 };
 
 struct pdata {
-	uint64_t	buf_va;
-	uint32_t	buf_rkey;
+	uint32_t	seg_size;	/* largest segment of a request */
+	uint32_t	format;		/* EC_METHOD_FORMAT of the fragments */
+};
+
+/* Operation of a request, in the immediate data of each of its segments,
+   the last one being flagged with OP_LAST. Once the request is served,
+   the next message of the client, of any kind, asks for the reply. An
+   encode flagged with OP_CRC is answered with the checksums of the
+   fragments after them, in network order. */
+enum {
+	OP_ENCODE	= 0,
+	OP_REPAIR	= 1,
+};
+
+#define OP_LAST (1U << 31)
+#define OP_CRC	(1U << 30)
+
+/* Repair request. The surviving fragments of rows[] follow it, one after
+   the other, at REPAIR_HDRSIZE; the reply holds the rebuilt fragments of
+   missing[] the same way, or nothing if the request is not valid. Fields
+   are in network order. */
+#define REPAIR_HDRSIZE 4096
+
+struct repair_req {
+	uint32_t	frag_size;
+	uint32_t	missing_count;
+	uint32_t	rows[COLUMN];
+	uint32_t	missing[ROW - COLUMN];
+};
+
+enum {
+	CONN_REQUEST,		/* receiving the segments of a request */
+	CONN_FETCH,		/* reply ready, waiting for the signal */
+	CONN_REPLY,		/* reply being sent */
+	CONN_CLOSING,		/* failed, waiting for the disconnection */
 };
 
-struct timeval time_start;
+struct conn {
+	struct rdma_cm_id	*cm_id;
+	int			state;
+	uint32_t		op;	/* of the request being received */
+	int			crc;	/* checksums asked by the encode */
+	size_t			len;	/* bytes of it received so far */
+	struct timeval		start;
+	unsigned		round;	/* of its fragment files */
+	int			fds[ROW];
+	size_t			align;	/* of O_DIRECT writes to them */
+	char			*out;	/* fragments of the last encode,
+					   then their checksums */
+	struct ibv_mr		*out_mr;
+	char			*repair_in;
+	char			*repair_out;
+	struct ibv_mr		*repair_mr;
+	char			*reply_buf;
+	size_t			reply_len;
+	struct ibv_mr		*reply_mr;
+};
 
-void start_timer() {
-        gettimeofday(&time_start,NULL);
+/* Send work requests are told from receives, whose wr_id is their slot,
+   by this bit; the rest is the index of the connection. */
+#define WR_SEND (1ULL << 32)
+
+/* -o: directory where the fragments of every round are stored, as files
+   <round>.<row>. By default the encoder writes them straight into mapped
+   files; with -d they are written from the output area of the connection
+   with O_DIRECT through io_uring, as each segment is encoded. The output
+   areas are the buffers of the ring, so a connection waits for its own
+   writes only. */
+static char *out_dir;
+static int out_direct;
+static unsigned rounds;
+static ec_uring_t ring;
+
+static unsigned window = WINDOW;
+static int nprocs;
+
+static struct conn conns[MAX_CONNS];
+static char *out_area;
+
+/* Verbs objects shared by the connections, created with the first one. */
+static struct ibv_pd *pd;
+static struct ibv_comp_channel *comp_chan;
+static struct ibv_cq *cq;
+static struct ibv_srq *srq;
+static struct ibv_qp_cap qp_cap;
+
+/* Receive ring. Slots whose segment has been handled are collected in
+   freed[] and posted back together once the CQ is drained. */
+static char *slots;
+static struct ibv_mr *slots_mr;
+static unsigned nslots;
+static uint32_t *freed;
+static unsigned nfreed;
+static struct ibv_recv_wr *slot_wr;
+static struct ibv_sge *slot_sge;
+
+void start_timer(struct timeval *start) {
+        gettimeofday(start,NULL);
 }
 
-void print_timer() {
+void print_timer(struct timeval *start) {
         struct timeval time_end, res;
         gettimeofday(&time_end,NULL);
-        timersub(&time_end,&time_start,&res);
+        timersub(&time_end,start,&res);
 
-        long long d = (time_end.tv_sec - time_start.tv_sec) * 1000000L + time_end.tv_usec - time_start.tv_usec;
+        long long d = res.tv_sec * 1000000L + res.tv_usec;
         double dd = d;
        printf("%.3lf s \n",dd / 1000000);
 
 }
 
-int main(int argc, char *argv[])
+static int open_fragment(unsigned round, int row, int flags)
 {
-	struct pdata			rep_pdata;
+	char path[4096];
 
-	struct rdma_event_channel      *cm_channel;
-	struct rdma_cm_id	       *listen_id;
-	struct rdma_cm_id	       *cm_id;
-	struct rdma_cm_event	       *event;
-	struct rdma_conn_param		conn_param = { };
-
-	struct ibv_pd		       *pd = NULL;
-	struct ibv_comp_channel	       *comp_chan;
-	struct ibv_cq		       *cq;
-	struct ibv_cq		       *evt_cq;
-	struct ibv_mr		       *send_mr = NULL;
-	struct ibv_mr		       *recv_mr = NULL;
-	struct ibv_qp_init_attr		qp_attr = { };
-	struct ibv_sge			sge;
-	struct ibv_send_wr		send_wr = { };
-	struct ibv_send_wr	       *bad_send_wr;
-	struct ibv_recv_wr		recv_wr = { };
-	struct ibv_recv_wr	       *bad_recv_wr;
-	struct ibv_wc			wc;
-	void			       *cq_context;
+	snprintf(path, sizeof(path), "%s/%u.%d", out_dir, round, row);
+	return open(path, O_CREAT | O_TRUNC | flags, 0644);
+}
 
-	struct sockaddr_in		sin;
+/* Sizes the shared objects for the pipeline window: window sends per
+   connection, a receive ring of window slots, and a CQ entry for every
+   one of them. Slots and segments are contiguous, so every work request
+   has a single scatter/gather entry. */
+static int size_queues(struct ibv_context *verbs,
+		       struct ibv_srq_init_attr *srq_attr, int *cqe)
+{
+	struct ibv_device_attr dev;
 
-	char				*recv_buf;
-	char				*send_buf;
-	char 				**out;
-	int				err;
-	int 				i;
+	if (ibv_query_device(verbs, &dev))
+		return -1;
 
-	recv_buf = malloc(BUFSIZE * sizeof(char));
-	send_buf = malloc(BUFSIZE * sizeof(char));
-	if (recv_buf == NULL || send_buf == NULL) return 1;
+	qp_cap.max_send_wr	= MIN(window, (unsigned)dev.max_qp_wr);
+	qp_cap.max_send_sge	= 1;
+	srq_attr->attr.max_wr	= MIN(window, (unsigned)dev.max_srq_wr);
+	srq_attr->attr.max_sge	= 1;
+	*cqe = MIN(MAX_CONNS * qp_cap.max_send_wr + srq_attr->attr.max_wr,
+		   (unsigned)dev.max_cqe);
 
-	/* Set up RDMA CM structures */
+	return 0;
+}
 
-	cm_channel = rdma_create_event_channel();
-	if (!cm_channel)
-		return 1;
+/* Posts the freed slots to the shared receive queue in one call. */
+static int replenish(void)
+{
+	struct ibv_recv_wr *bad_recv_wr;
+	unsigned i;
+
+	if (nfreed == 0)
+		return 0;
+
+	for (i = 0; i < nfreed; i++) {
+		slot_sge[i].addr   = (uintptr_t)(slots +
+						 (size_t)freed[i] * SLOTSIZE);
+		slot_sge[i].length = SLOTSIZE;
+		slot_sge[i].lkey   = slots_mr->lkey;
+
+		slot_wr[i].wr_id   = freed[i];
+		slot_wr[i].sg_list = &slot_sge[i];
+		slot_wr[i].num_sge = 1;
+		slot_wr[i].next	   = i + 1 < nfreed ? &slot_wr[i + 1] : NULL;
+	}
+	nfreed = 0;
 
-	err = rdma_create_id(cm_channel, &listen_id, NULL, RDMA_PS_TCP);
-	if (err)
-		return err;
+	return ibv_post_srq_recv(srq, slot_wr, &bad_recv_wr);
+}
 
-	sin.sin_family	    = AF_INET;
-	sin.sin_port	    = htons(20079);
-	sin.sin_addr.s_addr = INADDR_ANY;
+/* Creates the objects shared by the connections and posts the whole
+   receive ring. */
+static int setup_device(struct ibv_context *verbs)
+{
+	struct ibv_srq_init_attr srq_attr = { };
+	int cqe, flags;
+	unsigned i;
 
-	/* Bind to local port and listen for connection request */
+	if (size_queues(verbs, &srq_attr, &cqe))
+		return -1;
 
-	err = rdma_bind_addr(listen_id, (struct sockaddr *) &sin);
-	if (err)
-		return 1;
+	pd = ibv_alloc_pd(verbs);
+	if (!pd)
+		return -1;
 
-	err = rdma_listen(listen_id, 1);
-	if (err)
-		return 1;
+	comp_chan = ibv_create_comp_channel(verbs);
+	if (!comp_chan)
+		return -1;
+	flags = fcntl(comp_chan->fd, F_GETFL);
+	if (fcntl(comp_chan->fd, F_SETFL, flags | O_NONBLOCK))
+		return -1;
 
-	err = rdma_get_cm_event(cm_channel, &event);
-	if (err)
-		return err;
+	cq = ibv_create_cq(verbs, cqe, NULL, comp_chan, 0);
+	if (!cq)
+		return -1;
 
-	printf("get cm event: %d\n", event->event);
+	if (ibv_req_notify_cq(cq, 0))
+		return -1;
+
+	/* The device may round the queue up: keep the size the CQ was made
+	   for. */
+	nslots = srq_attr.attr.max_wr;
+	srq = ibv_create_srq(pd, &srq_attr);
+	if (!srq)
+		return -1;
+
+	slots = mmap(NULL, (size_t)nslots * SLOTSIZE, PROT_READ | PROT_WRITE,
+		     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	freed = malloc(nslots * sizeof(*freed));
+	slot_wr = calloc(nslots, sizeof(*slot_wr));
+	slot_sge = calloc(nslots, sizeof(*slot_sge));
+	if (slots == MAP_FAILED || !freed || !slot_wr || !slot_sge)
+		return -1;
+
+	slots_mr = ibv_reg_mr(pd, slots, (size_t)nslots * SLOTSIZE,
+			      IBV_ACCESS_LOCAL_WRITE);
+	if (!slots_mr)
+		return -1;
+
+	for (i = 0; i < nslots; i++)
+		freed[nfreed++] = i;
+
+	return replenish();
+}
 
-	if (event->event != RDMA_CM_EVENT_CONNECT_REQUEST)
-		return 1;
+/* Maps the fragment files of a round over buf, one after the other, so
+   that the encoder writes into the page cache and buf can still be sent
+   as a whole. */
+static int map_fragments(char *buf, unsigned round)
+{
+	void *ptr;
+	int i, fd;
+
+	for (i = 0; i < ROW; i++) {
+		fd = open_fragment(round, i, O_RDWR);
+		if (fd < 0)
+			return -1;
+		if (ftruncate(fd, FRAGSIZE)) {
+			close(fd);
+			return -1;
+		}
+		ptr = mmap(buf + i * FRAGSIZE, FRAGSIZE, PROT_READ | PROT_WRITE,
+			   MAP_SHARED | MAP_FIXED, fd, 0);
+		close(fd);
+		if (ptr == MAP_FAILED)
+			return -1;
+	}
 
-	cm_id = event->id;
+	return 0;
+}
 
-	rdma_ack_cm_event(event);
+static void close_fragments(struct conn *c)
+{
+	int i;
+
+	for (i = 0; i < ROW; i++) {
+		if (c->fds[i] >= 0)
+			close(c->fds[i]);
+		c->fds[i] = -1;
+	}
+}
 
-	/* Create verbs objects now that we know which device to use */
+/* Alignment of the offset, length and buffer of an O_DIRECT write to
+   fd. */
+static size_t direct_align(int fd)
+{
+#ifdef STATX_DIOALIGN
+	struct statx stx;
+
+	if (statx(fd, "", AT_EMPTY_PATH, STATX_DIOALIGN, &stx) == 0 &&
+	    (stx.stx_mask & STATX_DIOALIGN) && stx.stx_dio_offset_align)
+		return MAX(stx.stx_dio_offset_align, stx.stx_dio_mem_align);
+#endif
+	return DIO_ALIGN;
+}
 
-	if (!pd) {
-		pd = ibv_alloc_pd(cm_id->verbs);
-		if (!pd)
-			return 1;
+static int begin_encode(struct conn *c)
+{
+	int i;
+
+	c->round = rounds++;
+	if (out_dir && !out_direct)
+		return map_fragments(c->out, c->round);
+	if (out_dir && out_direct) {
+		for (i = 0; i < ROW; i++) {
+			c->fds[i] = open_fragment(c->round, i,
+						  O_WRONLY | O_DIRECT);
+			if (c->fds[i] < 0)
+				return -1;
+		}
+		c->align = direct_align(c->fds[0]);
 	}
 
-	comp_chan = ibv_create_comp_channel(cm_id->verbs);
-	if (!comp_chan)
-		return 1;
+	return 0;
+}
 
-	cq = ibv_create_cq(cm_id->verbs, 10, NULL, comp_chan, 0);
-	if (!cq)
-		return 1;
+/* Encodes the len bytes at in found at offset off of the data, and
+   checksums the chunks as they are encoded if the client asked for it.
+   With -d, the writes of the fragments of a segment run while the next
+   ones arrive and are encoded, so the encoder never waits on a write. */
+static int encode_segment(struct conn *c, char *in, size_t off, size_t len)
+{
+	uint8_t *out[ROW];
+	uint32_t *crc[ROW];
+	int i;
+
+	for (i = 0; i < ROW; i++) {
+		out[i] = (uint8_t *)c->out + i * FRAGSIZE + off / COLUMN;
+		crc[i] = (uint32_t *)(c->out + FRAGSIZE * ROW) +
+			 i * FRAGCHUNKS + off / STRIPESIZE;
+	}
+	ec_method_batch_parallel_encode_nt_crc(len, COLUMN, ROW, (uint8_t *)in,
+					       out, c->crc ? crc : NULL,
+					       nprocs);
+
+	if (!out_dir || !out_direct)
+		return 0;
+	for (i = 0; i < ROW; i++)
+		if (ec_uring_write(&ring, c->fds[i], out[i], len / COLUMN,
+				   off / COLUMN))
+			return -1;
+
+	return ec_uring_submit(&ring);
+}
 
-	if (ibv_req_notify_cq(cq, 0))
-		return 1;
+static int end_encode(struct conn *c)
+{
+	int err = 0;
+
+	if (out_dir && out_direct) {
+		err = ec_uring_wait(&ring, c - conns, 0);
+		close_fragments(c);
+	} else if (out_dir) {
+		/* The pages under the output area changed: register the new
+		   ones for the send. */
+		ibv_dereg_mr(c->out_mr);
+		c->out_mr = ibv_reg_mr(pd, c->out, OUTSIZE, 0);
+		if (!c->out_mr)
+			err = -1;
+	}
 
-	if (!recv_mr) {
-		recv_mr = ibv_reg_mr(pd, recv_buf, BUFSIZE,
-				IBV_ACCESS_LOCAL_WRITE |
-				IBV_ACCESS_REMOTE_READ |
-				IBV_ACCESS_REMOTE_WRITE);
-		if (!recv_mr)
-			return 1;
+	return err;
+}
+
+/* Rebuilds into buf the fragments asked by a repair request of len bytes
+   at in. Returns the size of the reply. */
+static size_t repair(char *in, size_t len, char *buf)
+{
+	struct repair_req *req = (struct repair_req *)in;
+	uint8_t *src[COLUMN], *out[ROW - COLUMN];
+	uint32_t rows[COLUMN], missing[ROW - COLUMN];
+	size_t size = ntohl(req->frag_size);
+	uint32_t count = ntohl(req->missing_count);
+	uint32_t i, seen = 0;
+
+	if (len < REPAIR_HDRSIZE + COLUMN * size || size == 0 ||
+	    size > FRAGSIZE || size % EC_METHOD_CHUNK_SIZE ||
+	    count > ROW - COLUMN)
+		return 0;
+	for (i = 0; i < COLUMN; i++) {
+		rows[i] = ntohl(req->rows[i]);
+		if (rows[i] >= ROW || (seen & (1 << rows[i])))
+			return 0;
+		seen |= 1 << rows[i];
+		src[i] = (uint8_t *)in + REPAIR_HDRSIZE + i * size;
 	}
-	if (!send_mr) {
-		send_mr = ibv_reg_mr(pd, send_buf, BUFSIZE,
-				IBV_ACCESS_LOCAL_WRITE |
-				IBV_ACCESS_REMOTE_READ |
-				IBV_ACCESS_REMOTE_WRITE);
-		if (!send_mr)
-			return 1;
+	for (i = 0; i < count; i++) {
+		missing[i] = ntohl(req->missing[i]);
+		if (missing[i] >= ROW)
+			return 0;
+		out[i] = (uint8_t *)buf + i * size;
 	}
 
-	qp_attr.cap.max_send_wr	 = 10;
-	qp_attr.cap.max_send_sge = 10;
-	qp_attr.cap.max_recv_wr	 = 10;
-	qp_attr.cap.max_recv_sge = 10;
+	ec_method_parallel_repair(size, COLUMN, rows, src, count, missing,
+				  out, nprocs);
 
-	qp_attr.send_cq		 = cq;
-	qp_attr.recv_cq		 = cq;
+	return count * size;
+}
 
-	qp_attr.qp_type		 = IBV_QPT_RC;
+/* The survivors of a repair request are gathered from the ring, as the
+   repair needs all of them at once. */
+static int begin_repair(struct conn *c)
+{
+	if (c->repair_in)
+		return 0;
+
+	c->repair_in = malloc(REPAIR_HDRSIZE + COLUMN * FRAGSIZE);
+	c->repair_out = malloc((ROW - COLUMN) * FRAGSIZE);
+	if (!c->repair_in || !c->repair_out)
+		return -1;
+	c->repair_mr = ibv_reg_mr(pd, c->repair_out, (ROW - COLUMN) * FRAGSIZE,
+				  IBV_ACCESS_LOCAL_WRITE);
+	if (!c->repair_mr)
+		return -1;
 
-	err = rdma_create_qp(cm_id, pd, &qp_attr);
-	if (err)
-		return err;
+	return 0;
+}
 
-	/* Post receive before accepting connection */
+static int finish_request(struct conn *c)
+{
+	uint32_t *crc = (uint32_t *)(c->out + FRAGSIZE * ROW);
+	size_t i;
+
+	if (c->op == OP_REPAIR) {
+		c->reply_len = repair(c->repair_in, c->len, c->repair_out);
+		printf("repair : %zu bytes\n", c->reply_len);
+		c->reply_buf = c->repair_out;
+		c->reply_mr = c->repair_mr;
+	} else {
+		printf("encode : %d round %u %d\n", DATASIZE, c->round,
+		       nprocs);
+		if (c->len != DATASIZE || end_encode(c))
+			return -1;
+		c->reply_buf = c->out;
+		c->reply_len = FRAGSIZE * ROW;
+		c->reply_mr = c->out_mr;
+		if (c->crc) {
+			for (i = 0; i < ROW * FRAGCHUNKS; i++)
+				crc[i] = htonl(crc[i]);
+			c->reply_len = OUTSIZE;
+		}
+	}
+	print_timer(&c->start);
 
-	sge.addr   = recv_buf;
-	sge.length = BUFSIZE;
-	sge.lkey   = recv_mr->lkey;
+	c->len = 0;
+	c->state = CONN_FETCH;
 
-	recv_wr.sg_list = &sge;
-	recv_wr.num_sge = 1;
+	return 0;
+}
 
-	if (ibv_post_recv(cm_id->qp, &recv_wr, &bad_recv_wr))
-		return 1;
+static int send_reply(struct conn *c)
+{
+	struct ibv_sge sge;
+	struct ibv_send_wr send_wr = { }, *bad_send_wr;
 
-	rep_pdata.buf_va   = htonll(recv_buf);
-	rep_pdata.buf_rkey = htonl(recv_mr->rkey);
+	sge.addr   = (uintptr_t)c->reply_buf;
+	sge.length = c->reply_len;
+	sge.lkey   = c->reply_mr->lkey;
 
-	conn_param.responder_resources = 1;
-	conn_param.private_data	       = &rep_pdata;
-	conn_param.private_data_len    = sizeof rep_pdata;
+	send_wr.wr_id	   = WR_SEND | (c - conns);
+	send_wr.opcode	   = IBV_WR_SEND;
+	send_wr.send_flags = IBV_SEND_SIGNALED;
+	send_wr.sg_list	   = &sge;
+	send_wr.num_sge	   = 1;
 
-	/* Accept connection */
+	c->state = CONN_REPLY;
 
-	err = rdma_accept(cm_id, &conn_param);
-	if (err)
-		return 1;
+	return ibv_post_send(c->cm_id->qp, &send_wr, &bad_send_wr);
+}
 
-	err = rdma_get_cm_event(cm_channel, &event);
-	if (err)
-		return err;
+/* Handles a segment received in a slot of the ring. */
+static int handle_recv(struct conn *c, struct ibv_wc *wc, char *seg)
+{
+	size_t len = wc->byte_len;
+	uint32_t op;
+
+	if (c->state == CONN_CLOSING)
+		return 0;
+	if (c->state == CONN_FETCH)
+		return send_reply(c);
+	if (c->state != CONN_REQUEST || !(wc->wc_flags & IBV_WC_WITH_IMM))
+		return -1;
+
+	op = ntohl(wc->imm_data);
+	if (c->len == 0) {
+		c->op = op & ~(OP_LAST | OP_CRC);
+		c->crc = !!(op & OP_CRC);
+		start_timer(&c->start);
+		if (c->op == OP_ENCODE && begin_encode(c))
+			return -1;
+		if (c->op == OP_REPAIR && begin_repair(c))
+			return -1;
+	} else if ((op & ~(OP_LAST | OP_CRC)) != c->op) {
+		return -1;
+	}
 
-	if (event->event != RDMA_CM_EVENT_ESTABLISHED)
-		return 1;
+	if (c->op == OP_ENCODE) {
+		if (c->len + len > DATASIZE || len % STRIPESIZE)
+			return -1;
+		if (out_dir && out_direct && len / COLUMN % c->align)
+			return -1;
+		if (encode_segment(c, seg, c->len, len))
+			return -1;
+	} else if (c->op == OP_REPAIR) {
+		if (c->len + len > REPAIR_HDRSIZE + COLUMN * FRAGSIZE)
+			return -1;
+		memcpy(c->repair_in + c->len, seg, len);
+	} else {
+		return -1;
+	}
+	c->len += len;
 
-	rdma_ack_cm_event(event);
+	if (op & OP_LAST)
+		return finish_request(c);
 
-	while (1) {
+	return 0;
+}
 
-		/* Wait for receive completion */
+static void drop_conn(struct conn *c)
+{
+	c->state = CONN_CLOSING;
+	rdma_disconnect(c->cm_id);
+}
 
-		if (ibv_get_cq_event(comp_chan, &evt_cq, &cq_context))
-			return 1;
+static struct conn *find_conn(uint32_t qp_num)
+{
+	int i;
 
-		if (ibv_req_notify_cq(cq, 0))
-			return 1;
+	for (i = 0; i < MAX_CONNS; i++)
+		if (conns[i].cm_id && conns[i].cm_id->qp->qp_num == qp_num)
+			return &conns[i];
 
-		if (ibv_poll_cq(cq, 1, &wc) < 1)
-			return 1;
+	return NULL;
+}
 
-		if (wc.status != IBV_WC_SUCCESS)
-			return 1;
+/* Handles the completions on the CQ, then gives their slots back to the
+   ring. A connection whose request fails is dropped. */
+static int poll_completions(void)
+{
+	struct ibv_wc wc[POLL_BATCH];
+	struct ibv_cq *evt_cq;
+	void *cq_context;
+	struct conn *c;
+	int i, n;
+
+	if (ibv_get_cq_event(comp_chan, &evt_cq, &cq_context))
+		return 0;
+	ibv_ack_cq_events(cq, 1);
+	if (ibv_req_notify_cq(cq, 0))
+		return -1;
+
+	while ((n = ibv_poll_cq(cq, POLL_BATCH, wc)) > 0) {
+		for (i = 0; i < n; i++) {
+			if (wc[i].wr_id & WR_SEND) {
+				c = &conns[wc[i].wr_id & ~WR_SEND];
+				if (!c->cm_id)
+					continue;
+				if (wc[i].status == IBV_WC_SUCCESS)
+					c->state = CONN_REQUEST;
+				else
+					drop_conn(c);
+				continue;
+			}
+
+			freed[nfreed++] = wc[i].wr_id;
+			c = find_conn(wc[i].qp_num);
+			if (c && (wc[i].status != IBV_WC_SUCCESS ||
+				  handle_recv(c, &wc[i],
+					      slots + wc[i].wr_id * SLOTSIZE)))
+				drop_conn(c);
+		}
+		if (replenish())
+			return -1;
+	}
 
-		ibv_ack_cq_events(cq, 1);
+	return n;
+}
 
-		// post another receive
-		sge.addr   = recv_buf;
-		sge.length = BUFSIZE;
-		sge.lkey   = recv_mr->lkey;
+static int accept_conn(struct rdma_cm_id *cm_id)
+{
+	struct rdma_conn_param conn_param = { };
+	struct ibv_qp_init_attr qp_attr = { };
+	struct pdata rep_pdata;
+	struct conn *c = NULL;
+	int i;
+
+	for (i = 0; i < MAX_CONNS && !c; i++)
+		if (!conns[i].cm_id)
+			c = &conns[i];
+	if (!c)
+		return -1;
+
+	if (!pd && setup_device(cm_id->verbs))
+		return -1;
+
+	qp_attr.cap	= qp_cap;
+	qp_attr.send_cq = cq;
+	qp_attr.recv_cq = cq;
+	qp_attr.srq	= srq;
+	qp_attr.qp_type = IBV_QPT_RC;
+
+	if (rdma_create_qp(cm_id, pd, &qp_attr))
+		return -1;
+
+	/* The output area is only the source of sends: no access flag. Local
+	   write would make the kernel pin it for writing, which it refuses
+	   (EFAULT, since Linux 6.5) for the file pages mapped over it with
+	   -o. */
+	c->out_mr = ibv_reg_mr(pd, c->out, OUTSIZE, 0);
+	if (!c->out_mr)
+		goto err_qp;
+	c->cm_id = cm_id;
+	c->state = CONN_REQUEST;
+	c->len = 0;
+	for (i = 0; i < ROW; i++)
+		c->fds[i] = -1;
+
+	rep_pdata.seg_size = htonl(SLOTSIZE);
+	rep_pdata.format   = htonl(EC_METHOD_FORMAT);
 
-		recv_wr.sg_list = &sge;
-		recv_wr.num_sge = 1;
+	conn_param.responder_resources = 1;
+	conn_param.rnr_retry_count     = 7;
+	conn_param.private_data	       = &rep_pdata;
+	conn_param.private_data_len    = sizeof rep_pdata;
 
-		if (ibv_post_recv(cm_id->qp, &recv_wr, &bad_recv_wr))
-			return 1;
+	if (rdma_accept(cm_id, &conn_param))
+		goto err_mr;
 
-		//encode
+	return 0;
 
-		printf("encode : %d %d %d %d\n", DATASIZE, sizeof(recv_buf), sizeof(send_buf), get_nprocs());
-		start_timer();
-		out = (char**)malloc(ROW * sizeof(char*));
-		for (i = 0; i < ROW; i++)
-			out[i] = send_buf + i * (DATASIZE / COLUMN);
-		ec_method_batch_parallel_encode(DATASIZE, COLUMN, ROW, recv_buf, out, get_nprocs());
-		free(out);
-		print_timer();
+err_mr:
+	ibv_dereg_mr(c->out_mr);
+	c->out_mr = NULL;
+	c->cm_id = NULL;
+err_qp:
+	rdma_destroy_qp(cm_id);
+	return -1;
+}
 
-		//wait client's signal to send data back
+/* Writes from the output area are drained before its files are closed,
+   and before the area goes to the next connection. */
+static void close_conn(struct conn *c)
+{
+	char *out = c->out;
+
+	if (out_dir && out_direct)
+		ec_uring_wait(&ring, c - conns, 0);
+	close_fragments(c);
+	rdma_destroy_qp(c->cm_id);
+	rdma_destroy_id(c->cm_id);
+	ibv_dereg_mr(c->out_mr);
+	if (c->repair_mr)
+		ibv_dereg_mr(c->repair_mr);
+	free(c->repair_in);
+	free(c->repair_out);
+
+	memset(c, 0, sizeof(*c));
+	c->out = out;
+}
 
-		if (ibv_get_cq_event(comp_chan, &evt_cq, &cq_context))
-			return 1;
+static int handle_cm_event(struct rdma_event_channel *cm_channel)
+{
+	struct rdma_cm_event *event;
+	struct rdma_cm_id *cm_id;
+	enum rdma_cm_event_type type;
+	int i;
 
-		if (ibv_req_notify_cq(cq, 0))
-			return 1;
+	if (rdma_get_cm_event(cm_channel, &event))
+		return 0;
 
-		if (ibv_poll_cq(cq, 1, &wc) < 1)
-			return 1;
+	type = event->event;
+	cm_id = event->id;
+	rdma_ack_cm_event(event);
 
-		ibv_ack_cq_events(cq, 1);
-	
-		// send data back to client
+	printf("get cm event: %d\n", type);
+
+	switch (type) {
+	case RDMA_CM_EVENT_CONNECT_REQUEST:
+		if (accept_conn(cm_id)) {
+			rdma_reject(cm_id, NULL, 0);
+			rdma_destroy_id(cm_id);
+		}
+		break;
+	case RDMA_CM_EVENT_CONNECT_ERROR:
+	case RDMA_CM_EVENT_UNREACHABLE:
+	case RDMA_CM_EVENT_REJECTED:
+	case RDMA_CM_EVENT_DISCONNECTED:
+		for (i = 0; i < MAX_CONNS; i++)
+			if (conns[i].cm_id == cm_id)
+				close_conn(&conns[i]);
+		break;
+	default:
+		break;
+	}
 
-		sge.addr   = send_buf;
-		sge.length = DATASIZE / COLUMN * ROW;
-		sge.lkey   = send_mr->lkey;
+	return 0;
+}
 
-		send_wr.opcode     = IBV_WR_SEND;
-		send_wr.send_flags = IBV_SEND_SIGNALED;
-		send_wr.sg_list    = &sge;
-		send_wr.num_sge    = 1;
+static void usage(const char *name)
+{
+	fprintf(stderr, "usage: %s [-o dir [-d]] [-w window]\n", name);
+}
 
-		if (ibv_post_send(cm_id->qp, &send_wr, &bad_send_wr))
+int main(int argc, char *argv[])
+{
+	struct rdma_event_channel      *cm_channel;
+	struct rdma_cm_id	       *listen_id;
+	struct sockaddr_in		sin;
+	struct pollfd			fds[2];
+	int				err;
+	int				i;
+	int				opt;
+
+	while ((opt = getopt(argc, argv, "o:dw:")) != -1) {
+		switch (opt) {
+		case 'o':
+			out_dir = optarg;
+			break;
+		case 'd':
+			out_direct = 1;
+			break;
+		case 'w':
+			window = atoi(optarg);
+			break;
+		default:
+			usage(argv[0]);
 			return 1;
+		}
+	}
+	if (window == 0) {
+		usage(argv[0]);
+		return 1;
+	}
+	nprocs = get_nprocs();
+
+	/* Page aligned, for O_DIRECT and for mapping fragment files over
+	   it. Pages are only used by connections that encode. */
+	out_area = mmap(NULL, (size_t)MAX_CONNS * OUTSIZE,
+			PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (out_area == MAP_FAILED)
+		return 1;
+	for (i = 0; i < MAX_CONNS; i++)
+		conns[i].out = out_area + (size_t)i * OUTSIZE;
+	if (out_dir && out_direct &&
+	    ec_uring_init(&ring, URING_DEPTH, out_area, OUTSIZE,
+			  MAX_CONNS))
+		return 1;
 
-		/* Wait for send completion */
+	/* Set up RDMA CM structures */
 
-		if (ibv_get_cq_event(comp_chan, &evt_cq, &cq_context))
-			return 1;
+	cm_channel = rdma_create_event_channel();
+	if (!cm_channel)
+		return 1;
+	if (fcntl(cm_channel->fd, F_SETFL,
+		  fcntl(cm_channel->fd, F_GETFL) | O_NONBLOCK))
+		return 1;
 
-		if (ibv_poll_cq(cq, 1, &wc) < 1)
-			return 1;
+	err = rdma_create_id(cm_channel, &listen_id, NULL, RDMA_PS_TCP);
+	if (err)
+		return err;
 
-		if (wc.status != IBV_WC_SUCCESS) 
-			return 1; 
+	sin.sin_family	    = AF_INET;
+	sin.sin_port	    = htons(20079);
+	sin.sin_addr.s_addr = INADDR_ANY;
 
-		ibv_ack_cq_events(cq, 1);
-		ibv_req_notify_cq(cq, 0);
+	/* Bind to local port and listen for connection requests */
 
-		// post another receive for next round
+	err = rdma_bind_addr(listen_id, (struct sockaddr *) &sin);
+	if (err)
+		return 1;
+
+	err = rdma_listen(listen_id, MAX_CONNS);
+	if (err)
+		return 1;
 
-		sge.addr   = recv_buf;
-		sge.length = BUFSIZE;
-		sge.lkey   = recv_mr->lkey;
+	/* Serve connection events and completions of every connection. The
+	   completion channel only exists once a client is connected. */
 
-		recv_wr.sg_list = &sge;
-		recv_wr.num_sge = 1;
+	fds[0].fd     = cm_channel->fd;
+	fds[0].events = POLLIN;
+	fds[1].fd     = -1;
+	fds[1].events = POLLIN;
+
+	while (1) {
+		if (poll(fds, 2, -1) < 0)
+			return 1;
+
+		if (fds[0].revents && handle_cm_event(cm_channel))
+			return 1;
+		if (comp_chan)
+			fds[1].fd = comp_chan->fd;
 
-		if (ibv_post_recv(cm_id->qp, &recv_wr, &bad_recv_wr))
+		if (fds[1].revents && poll_completions() < 0)
 			return 1;
 	}
 